@@ -0,0 +1,170 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_ACTOR and FORWARD_TO_MEMBER_ACTOR_POST.
+ *
+ * Compares a member owned by an actor with the same member guarded by a std::mutex through
+ * FORWARD_TO_MEMBER_LOCKED. The end-to-end latency is the best of several runs of a single thread
+ * making calls one after the other and waiting for each result, in nanoseconds per call. The
+ * throughput is that of threads sending fire-and-forget calls, or calling through the mutex, for
+ * increasing numbers of threads, in millions of calls per second, counted once the last call has
+ * run. The actor fed by a single thread is also timed with a single producer ring.
+ *
+ * Usage: bench_actor [calls per thread] [max threads] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "forward_to_member_actor.hpp"
+#include "forward_to_member_locked.hpp"
+
+/**
+ * Member that isn't thread-safe, doing little work per call so that the cost of reaching it is
+ * what is measured.
+ */
+struct counter
+{
+    long value = 0;
+    long add(long n) { return value += n; }
+    long get() const { return value; }
+};
+
+struct mutex_counter
+{
+    mutable std::mutex mutex;
+    counter c;
+    FORWARD_TO_MEMBER_LOCKED(c, add, add, mutex);
+    FORWARD_TO_MEMBER_LOCKED(c, get, get, mutex);
+};
+
+struct actor_counter
+{
+    forward_to_member::actor<counter> c;
+    FORWARD_TO_MEMBER_ACTOR(c, add, add);
+    FORWARD_TO_MEMBER_ACTOR_POST(c, add, add_post);
+    FORWARD_TO_MEMBER_ACTOR(c, get, get);
+};
+
+struct single_producer_counter
+{
+    forward_to_member::single_producer_actor<counter> c;
+    FORWARD_TO_MEMBER_ACTOR(c, add, add);
+    FORWARD_TO_MEMBER_ACTOR_POST(c, add, add_post);
+    FORWARD_TO_MEMBER_ACTOR(c, get, get);
+};
+
+long wait_result(long result)
+{
+    return result;
+}
+
+template<typename Future>
+long wait_result(Future&& future)
+{
+    return future.get();
+}
+
+/**
+ * Returns the best time in nanoseconds per call of repeat runs of calls made one after the other,
+ * each waited for.
+ */
+template<typename Counter>
+double latency(long calls, int repeat)
+{
+    Counter counter;
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        long sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < calls; ++j)
+        {
+            sink += wait_result(counter.add(1));
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        volatile long keep = sink;
+        (void)keep;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best / calls;
+}
+
+void add(mutex_counter& counter, long n)
+{
+    counter.add(n);
+}
+
+template<typename Counter>
+void add(Counter& counter, long n)
+{
+    counter.add_post(n);
+}
+
+/**
+ * Returns the throughput in millions of calls per second of threads each making calls, until the
+ * last of them has run.
+ */
+template<typename Counter>
+double throughput(unsigned threads, long calls)
+{
+    Counter counter;
+    std::vector<std::thread> senders;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        senders.emplace_back([&]()
+        {
+            for (long i = 0; i < calls; ++i)
+            {
+                add(counter, 1);
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    if (wait_result(counter.get()) != static_cast<long>(threads) * calls)
+    {
+        std::abort();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return threads * calls / elapsed.count();
+}
+
+template<typename Counter>
+void report(const char* name, unsigned max_threads, long calls, int repeat)
+{
+    std::printf("%-16s %10.1f", name, latency<Counter>(calls / 10, repeat));
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %10.2f", throughput<Counter>(threads, calls));
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const unsigned max_threads = argc > 2 ? std::atoi(argv[2]) : 8;
+    const int repeat = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    std::printf("%ld calls per thread, %u hardware threads, latency in ns, throughput in Mcalls/s\n",
+                calls, std::thread::hardware_concurrency());
+    std::printf("%-16s %10s", "member", "latency");
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %7u thr", threads);
+    }
+    std::printf("\n");
+
+    report<mutex_counter>("std::mutex", max_threads, calls, repeat);
+    report<actor_counter>("actor", max_threads, calls, repeat);
+    report<single_producer_counter>("single producer", 1, calls, repeat);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_ADAPT.
+ *
+ * Calls the methods of a member taking a const std::string&, a std::string_view and a std::span,
+ * and a const std::vector&, with arguments varying from call to call, once through functions
+ * exposed by FORWARD_TO_MEMBER_ADAPT and once through hand-written methods doing the same
+ * conversions. The best of several runs of each is
+ * reported in nanoseconds per call, along with the number of allocations per call, which should be
+ * the same for both: one for the conversions to owning types, none for the others.
+ *
+ * Usage: bench_adapt [calls] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "forward_to_member_adapt.hpp"
+
+static long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+/**
+ * Member whose methods are kept out of line so that both variants make the same calls.
+ */
+struct catalog
+{
+    __attribute__((noinline)) long find(const std::string& key) const { return key.size(); }
+    __attribute__((noinline)) long length(std::string_view key) const { return key.size(); }
+    __attribute__((noinline)) long sum(std::span<const int> s) const { return s.size() + s[0]; }
+    __attribute__((noinline)) long count(const std::vector<int>& v) const { return v.size(); }
+};
+
+struct facade
+{
+    catalog c;
+
+    FORWARD_TO_MEMBER_ADAPT(c, find, find, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, length, length, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, sum, sum, forward_to_member::pointer_length_as_span);
+    FORWARD_TO_MEMBER_ADAPT(c, count, count, forward_to_member::span_as_vector);
+
+    long find_by_hand(std::string_view key) const { return c.find(std::string(key)); }
+    long length_by_hand(std::string_view key) const { return c.length(key); }
+    long sum_by_hand(const int* data, std::size_t size) const
+    {
+        return c.sum(std::span<const int>(data, size));
+    }
+    long count_by_hand(std::span<const int> s) const
+    {
+        return c.count(std::vector<int>(s.begin(), s.end()));
+    }
+};
+
+struct result
+{
+    double ns;
+    double allocations;
+};
+
+/**
+ * Returns the best wall time in nanoseconds per call of repeat runs each making calls with call,
+ * and the number of allocations per call.
+ */
+template<typename Call>
+result best_of(int repeat, long calls, Call call)
+{
+    result best = {0, 0};
+    for (int i = 0; i < repeat; ++i)
+    {
+        long sink = 0;
+        const long before = allocations;
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < calls; ++j)
+        {
+            sink += call(j);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        volatile long keep = sink;
+        (void)keep;
+        if (i == 0 || elapsed.count() < best.ns)
+        {
+            best = {elapsed.count(), static_cast<double>(allocations - before) / calls};
+        }
+    }
+    best.ns /= calls;
+    return best;
+}
+
+void report(const char* name, result hand, result adapted)
+{
+    std::printf("%-26s %10.2f %10.2f %10.2f %10.2f\n", name, hand.ns, adapted.ns, hand.allocations,
+                adapted.allocations);
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 5000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    const facade f{};
+    const std::string_view key = "a key much too long to fit in the small string buffer";
+    const int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const std::span<const int> span(numbers);
+
+    std::printf("%ld calls, best of %d runs\n", calls, repeat);
+    std::printf("%-26s %10s %10s %10s %10s\n", "conversion", "hand ns", "adapted ns", "hand allocs",
+                "allocs");
+    report("string_view to string",
+           best_of(repeat, calls, [&](long j) { return f.find_by_hand(key.substr(j & 7)); }),
+           best_of(repeat, calls, [&](long j) { return f.find(key.substr(j & 7)); }));
+    report("string_view passed as is",
+           best_of(repeat, calls, [&](long j) { return f.length_by_hand(key.substr(j & 7)); }),
+           best_of(repeat, calls, [&](long j) { return f.length(key.substr(j & 7)); }));
+    report("pointer, length to span",
+           best_of(repeat, calls, [&](long j) { return f.sum_by_hand(numbers, 1 + (j & 7)); }),
+           best_of(repeat, calls, [&](long j) { return f.sum(numbers, 1 + (j & 7)); }));
+    report("span to vector",
+           best_of(repeat, calls, [&](long j) { return f.count_by_hand(span.first(1 + (j & 7))); }),
+           best_of(repeat, calls, [&](long j) { return f.count(span.first(1 + (j & 7))); }));
+    return 0;
+}
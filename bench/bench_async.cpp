@@ -0,0 +1,132 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_ASYNC.
+ *
+ * Calls a cheap method 10^6 times directly and through FORWARD_TO_MEMBER_ASYNC on thread pools of
+ * several sizes, submitting the calls in batches and waiting for the futures of each batch. The
+ * best of several runs is reported for each as calls per second, along with the number of heap
+ * allocations per call.
+ *
+ * Usage: bench_async [calls] [repeat] [batch]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "forward_to_member_async.hpp"
+
+/**
+ * Number of allocations made through the global operator new.
+ */
+static std::atomic<long> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+struct counter
+{
+    std::atomic<long> total;
+    counter() : total(0) { }
+    long add(long value, long times) { return total.fetch_add(value * times) + value * times; }
+};
+
+struct service
+{
+    forward_to_member::thread_pool pool;
+    counter c;
+    FORWARD_TO_MEMBER_ASYNC(c, add, add_async, pool);
+
+    explicit service(unsigned threads) : pool(threads) { }
+};
+
+/**
+ * Returns the best wall time in milliseconds of repeat runs of run.
+ */
+template<typename Run>
+double best_of(int repeat, Run run)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+void report(const char* name, long calls, double ms, long allocated)
+{
+    std::printf("%-16s %10.2f %14.0f %12.2f\n", name, ms, calls / ms * 1000.0,
+                static_cast<double>(allocated) / calls);
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+    const std::size_t batch = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 256;
+
+    std::printf("%ld calls in batches of %zu, %u hardware threads, best of %d runs\n", calls, batch,
+                std::thread::hardware_concurrency(), repeat);
+    std::printf("%-16s %10s %14s %12s\n", "variant", "ms", "calls/s", "allocs/call");
+
+    counter direct;
+    long before = allocations;
+    const double ms = best_of(repeat, [&]()
+    {
+        for (long i = 0; i < calls; ++i)
+        {
+            direct.add(i, 2);
+        }
+    });
+    report("direct", calls, ms, (allocations - before) / repeat);
+
+    for (unsigned threads : {1, 2, 4})
+    {
+        service s(threads);
+        std::vector<forward_to_member::async_future<long>> futures;
+        futures.reserve(batch);
+        before = allocations;
+        const double ms = best_of(repeat, [&]()
+        {
+            for (long i = 0; i < calls; i += batch)
+            {
+                for (long j = i; j < calls && j < i + static_cast<long>(batch); ++j)
+                {
+                    futures.push_back(s.add_async(j, 2));
+                }
+                for (auto& future : futures)
+                {
+                    future.get();
+                }
+                futures.clear();
+            }
+        });
+        char name[32];
+        std::snprintf(name, sizeof(name), "async %u threads", threads);
+        report(name, calls, ms, (allocations - before) / repeat);
+    }
+    return 0;
+}
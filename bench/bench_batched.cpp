@@ -0,0 +1,111 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_BATCHED.
+ *
+ * Inserts 10^6 values into a member that takes a lock per call, through an unbatched forwarded
+ * function calling the per-item method and through batched forwarded functions calling the bulk
+ * method, which takes the lock once per batch, with several capacities. The best of several runs
+ * is reported for each, along with its speedup over the unbatched forwarding.
+ *
+ * Usage: bench_batched [calls] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+#include "forward_to_member_batched.hpp"
+
+/**
+ * Member synchronizing every call, like a shared index or queue would.
+ */
+struct locked_log
+{
+    std::mutex mutex;
+    std::vector<long> values;
+
+    void append(long value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values.push_back(value);
+    }
+
+    void append_batch(long* items, std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values.insert(values.end(), items, items + count);
+    }
+};
+
+struct unbatched
+{
+    locked_log log;
+    FORWARD_TO_MEMBER(log, append);
+};
+
+#define BATCHED(name, capacity)                                                                    \
+    struct name                                                                                    \
+    {                                                                                              \
+        locked_log log;                                                                            \
+        FORWARD_TO_MEMBER_BATCHED_CAPACITY(log, append, append_batch, append, capacity);           \
+        void flush() { flush_append(); }                                                           \
+    }
+
+BATCHED(batched_16, 16);
+BATCHED(batched_64, 64);
+BATCHED(batched_1024, 1024);
+
+/**
+ * Returns the best wall time in milliseconds of repeat runs of calls appends on a fresh W.
+ */
+template<typename W, typename Finish>
+double best_of(int repeat, long calls, Finish finish)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        W w;
+        w.log.values.reserve(calls);
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < calls; ++j)
+        {
+            w.append(j + 0);
+        }
+        finish(w);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (static_cast<long>(w.log.values.size()) != calls)
+        {
+            std::fprintf(stderr, "lost calls\n");
+            std::exit(1);
+        }
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+template<typename W>
+void report(const char* name, int repeat, long calls, double unbatched_ms)
+{
+    const double ms = best_of<W>(repeat, calls, [](W& w) { w.flush(); });
+    std::printf("%-16s %10.2f %10.2f %8.2f\n", name, ms, calls / ms / 1000.0, unbatched_ms / ms);
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::printf("%ld calls, best of %d runs\n", calls, repeat);
+    std::printf("%-16s %10s %10s %8s\n", "variant", "ms", "Mcalls/s", "speedup");
+
+    const double unbatched_ms = best_of<unbatched>(repeat, calls, [](unbatched&) { });
+    std::printf("%-16s %10.2f %10.2f %8.2f\n", "unbatched", unbatched_ms,
+                calls / unbatched_ms / 1000.0, 1.0);
+    report<batched_16>("batched 16", repeat, calls, unbatched_ms);
+    report<batched_64>("batched 64", repeat, calls, unbatched_ms);
+    report<batched_1024>("batched 1024", repeat, calls, unbatched_ms);
+    return 0;
+}
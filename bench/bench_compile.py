@@ -0,0 +1,326 @@
+#!/usr/bin/env python3
+"""
+Compile-time benchmark for forward_to_member.hpp.
+
+Generates synthetic translation units that forward N methods, each having M overloads spread across
+every cv class, to members of every pointer kind (value, reference, pointer, shared_ptr, unique_ptr)
+with every cv combination on the pointed-to type. Each translation unit is compiled with every available
+compiler and the wall time, peak compiler resident set size and number of template instantiations
+are reported per configuration.
+
+Each configuration can be written with several variants of the macros so they can be compared:
+"as" uses one FORWARD_TO_MEMBER_AS per method and "all" a single FORWARD_TO_MEMBER_ALL per member,
+both including forward_to_member.hpp. "core" is "as" including only forward_to_member_core.hpp, and
+forward_to_member_memory.hpp for the shared_ptr and unique_ptr kinds, and "module" is "as" importing
+the forward_to_member module built from forward_to_member.cppm, which needs --std c++20 or later and
+is skipped otherwise. The module is built once per compiler, which is reported separately.
+
+The "path" and "stacked" variants reach the member one hop further, through a value member h of an
+intermediate class holding it: "path" uses one FORWARD_TO_MEMBER_PATH((h, m), ...) per method, and
+"stacked" one FORWARD_TO_MEMBER_AS per method on both the intermediate class and the wrapper.
+
+Template instantiations are counted from -ftime-trace for clang++ (InstantiateFunction and
+InstantiateClass events) and from -fdump-tree-original for g++ (function bodies generated from a
+template, i.e. those printed with "[with ...]").
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+
+# Qualifiers a generated overload can carry, cycled through so every overload set covers every class.
+QUALIFIERS = ["", "volatile", "const", "const volatile"]
+
+# cv combinations applied to the member (or the pointed-to type for indirect members).
+MEMBER_CV = ["", "volatile", "const", "const volatile"]
+
+# Declaration and initializer for each member kind. {target} is the cv qualified target type.
+KINDS = {
+    "value":      ("{target} {name};",                  "{name}(t)"),
+    "reference":  ("{target}& {name};",                 "{name}(t)"),
+    "pointer":    ("{target}* {name};",                 "{name}(&t)"),
+    "shared_ptr": ("std::shared_ptr<{target}> {name};", "{name}(std::make_shared<{target}>(t))"),
+    "unique_ptr": ("std::unique_ptr<{target}> {name};", "{name}(new {target}(t))"),
+}
+
+# Kinds whose members need <memory>, and forward_to_member_memory.hpp for their pointer_like_traits.
+MEMORY_KINDS = ["shared_ptr", "unique_ptr"]
+
+
+def qualified(cv, name):
+    return (cv + " " + name).strip()
+
+
+def callable_on(qualifier, cv):
+    """Returns true if a method with the given qualifier may be called on an object with cv."""
+    return all(q in qualifier.split() for q in cv.split())
+
+
+def method_name(i):
+    return "f{}".format(i)
+
+
+def member_name(cv):
+    return "m_" + ("".join(q[0] for q in cv.split()) or "p")
+
+
+def generate_target(forwarders, overloads):
+    lines = ["struct target", "{", "    int state = 0;"]
+    for i in range(forwarders):
+        for j in range(overloads):
+            params = ", ".join("int a{}".format(k) for k in range(j + 1))
+            body = " + ".join("a{}".format(k) for k in range(j + 1))
+            signature = "{}({}) {}".format(method_name(i), params, QUALIFIERS[j % len(QUALIFIERS)])
+            lines.append("    int {} {{ return {}; }}".format(signature.strip(), body))
+    lines.append("};")
+    return lines
+
+
+def wrapper_name(cv):
+    return "wrapper_" + member_name(cv)[2:]
+
+
+def generate_calls(forwarders, overloads):
+    """Calls every forwarder with every overload that is legal for the member's cv."""
+    parameters = ", ".join("{}& {}".format(wrapper_name(cv), member_name(cv)) for cv in MEMBER_CV)
+    lines = ["int use({})".format(parameters), "{", "    int r = 0;"]
+    for cv in MEMBER_CV:
+        for i in range(forwarders):
+            for j in range(overloads):
+                if callable_on(QUALIFIERS[j % len(QUALIFIERS)], cv):
+                    args = ", ".join(str(k) for k in range(j + 1))
+                    lines.append("    r += {}.{}({});".format(member_name(cv), method_name(i), args))
+    lines += ["    return r;", "}"]
+    return lines
+
+
+def generate(kind, forwarders, overloads, forward, prologue=None, hop=None):
+    """
+    One wrapper class per cv combination, each holding a single member m of the given kind. The
+    forward function returns the lines that forward every method of m, and the prologue the lines
+    making the macros available, which include forward_to_member.hpp by default. Given a hop
+    function, m is held instead by a value member h of the wrapper, whose class forwards the lines
+    hop returns, and the lines forward returns are those forwarding every method along h.
+    """
+    declaration, initializer = KINDS[kind]
+    methods = [method_name(i) for i in range(forwarders)]
+    lines = (prologue or ['#include "forward_to_member.hpp"']) + [""]
+    lines += generate_target(forwarders, overloads)
+    for cv in MEMBER_CV:
+        target = qualified(cv, "target")
+        member, member_initializer = declaration.format(target=target, name="m"), initializer
+        if hop:
+            lines += ["", "struct hop_" + wrapper_name(cv), "{", "    " + member]
+            lines += ["    " + line for line in hop(methods)]
+            lines.append("    hop_{}(target& t) : {} {{ }}".format(
+                wrapper_name(cv), initializer.format(target=target, name="m")))
+            lines += ["};"]
+            member, member_initializer = "hop_{} h;".format(wrapper_name(cv)), "h(t)"
+        lines += ["", "struct " + wrapper_name(cv), "{"]
+        lines.append("    " + member)
+        lines += ["    " + line for line in forward(methods)]
+        lines.append("    {}(target& t) : {} {{ }}".format(
+            wrapper_name(cv), member_initializer.format(target=target, name="m")))
+        lines += ["};"]
+    lines.append("")
+    lines += generate_calls(forwarders, overloads)
+    return "\n".join(lines) + "\n"
+
+
+def generate_forward_to_member_as(kind, forwarders, overloads):
+    """One FORWARD_TO_MEMBER_AS per method."""
+    return generate(kind, forwarders, overloads,
+                    lambda methods: ["FORWARD_TO_MEMBER_AS(m, {0}, {0});".format(f) for f in methods])
+
+
+def generate_forward_to_member_all(kind, forwarders, overloads):
+    """A single FORWARD_TO_MEMBER_ALL for all methods."""
+    return generate(kind, forwarders, overloads,
+                    lambda methods: ["FORWARD_TO_MEMBER_ALL(m, {});".format(", ".join(methods))])
+
+
+def generate_forward_to_member_core(kind, forwarders, overloads):
+    """One FORWARD_TO_MEMBER_AS per method, including only the headers the member kind needs."""
+    prologue = ['#include "forward_to_member_core.hpp"']
+    if kind in MEMORY_KINDS:
+        prologue.append('#include "forward_to_member_memory.hpp"')
+    return generate(kind, forwarders, overloads,
+                    lambda methods: ["FORWARD_TO_MEMBER_AS(m, {0}, {0});".format(f) for f in methods],
+                    prologue)
+
+
+def generate_forward_to_member_module(kind, forwarders, overloads):
+    """One FORWARD_TO_MEMBER_AS per method, importing the module."""
+    prologue = ["#include <memory>"] if kind in MEMORY_KINDS else []
+    prologue += ["#include <type_traits>", "#include <utility>", "import forward_to_member;",
+                 '#include "forward_to_member_macros.hpp"']
+    return generate(kind, forwarders, overloads,
+                    lambda methods: ["FORWARD_TO_MEMBER_AS(m, {0}, {0});".format(f) for f in methods],
+                    prologue)
+
+
+def generate_forward_to_member_path(kind, forwarders, overloads):
+    """One FORWARD_TO_MEMBER_PATH per method, along h to m."""
+    return generate(kind, forwarders, overloads,
+                    lambda methods: ["FORWARD_TO_MEMBER_PATH((h, m), {0}, {0});".format(f)
+                                     for f in methods],
+                    hop=lambda methods: [])
+
+
+def generate_forward_to_member_stacked(kind, forwarders, overloads):
+    """One FORWARD_TO_MEMBER_AS per method on h forwarding to m, and on the wrapper to h."""
+    def forward(member):
+        return lambda methods: ["FORWARD_TO_MEMBER_AS({0}, {1}, {1});".format(member, f)
+                                for f in methods]
+    return generate(kind, forwarders, overloads, forward("h"), hop=forward("m"))
+
+
+# Each variant is a way of writing the same wrapper. Variants are compared against each other.
+VARIANTS = {
+    "as": generate_forward_to_member_as,
+    "all": generate_forward_to_member_all,
+    "core": generate_forward_to_member_core,
+    "module": generate_forward_to_member_module,
+    "path": generate_forward_to_member_path,
+    "stacked": generate_forward_to_member_stacked,
+}
+
+
+def is_clang(compiler):
+    return "clang" in os.path.basename(compiler)
+
+
+def std_year(std):
+    """The year of a -std value, e.g. 11 for c++11 and gnu++11, with c++2a and the like as 20."""
+    match = re.search(r"\+\+(\d)(\d|[a-z])", std)
+    return int(match.group(1)) * 10 + (int(match.group(2)) if match.group(2).isdigit() else 0)
+
+
+def build_module(compiler, std, workdir):
+    """
+    Builds the forward_to_member module in workdir and returns the flags importing it along with
+    the time the build took. g++ finds it in the gcm.cache directory of the working directory.
+    """
+    interface = os.path.join(ROOT, "forward_to_member.cppm")
+    if is_clang(compiler):
+        pcm = os.path.join(workdir, "forward_to_member.pcm")
+        command = [compiler, "-std=" + std, "-I" + ROOT, "-x", "c++-module", "--precompile",
+                   interface, "-o", pcm]
+        flags = ["-fmodule-file=forward_to_member=" + pcm]
+    else:
+        command = [compiler, "-std=" + std, "-I" + ROOT, "-fmodules-ts", "-x", "c++", "-c",
+                   interface, "-o", os.path.join(workdir, "forward_to_member.o")]
+        flags = ["-fmodules-ts"]
+    start = time.monotonic()
+    subprocess.check_call(command, cwd=workdir)
+    return flags, time.monotonic() - start
+
+
+def count_instantiations(compiler, source, std, workdir, flags):
+    if is_clang(compiler):
+        obj = os.path.join(workdir, "count.o")
+        subprocess.check_call([compiler, "-std=" + std, "-I" + ROOT, "-c", source, "-o", obj,
+                               "-ftime-trace", "-ftime-trace-granularity=0"] + flags, cwd=workdir)
+        with open(os.path.join(workdir, "count.json")) as trace:
+            events = json.load(trace)["traceEvents"]
+        return sum(1 for e in events if e.get("name") in ("InstantiateFunction", "InstantiateClass"))
+    dump = os.path.join(workdir, "count.original")
+    subprocess.check_call([compiler, "-std=" + std, "-I" + ROOT, "-c", source,
+                           "-o", os.path.join(workdir, "count.o"), "-fdump-tree-original=" + dump]
+                          + flags, cwd=workdir)
+    pattern = re.compile(r"^;; Function .*\[with ")
+    with open(dump, errors="replace") as original:
+        return sum(1 for line in original if pattern.match(line))
+
+
+def measure(compiler, source, std, workdir, flags):
+    """Returns (wall seconds, peak RSS in KiB) of a single compilation."""
+    command = [compiler, "-std=" + std, "-I" + ROOT, "-c", source,
+               "-o", os.path.join(workdir, "measure.o")] + flags
+    start = time.monotonic()
+    process = subprocess.Popen(command, cwd=workdir)
+    _, status, usage = os.wait4(process.pid, 0)
+    wall = time.monotonic() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        raise subprocess.CalledProcessError(process.returncode, command)
+    return wall, usage.ru_maxrss
+
+
+def parse_list(text):
+    return [item for item in text.split(",") if item]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compilers", default=os.environ.get("BENCH_CXX", "g++,clang++"),
+                        help="comma separated compilers, missing ones are skipped")
+    parser.add_argument("--std", default="c++11")
+    parser.add_argument("--forwarders", default="4,16", help="comma separated values of N")
+    parser.add_argument("--overloads", default="4,8", help="comma separated values of M")
+    parser.add_argument("--kinds", default=",".join(KINDS), help="comma separated member kinds")
+    parser.add_argument("--variants", default=",".join(VARIANTS), help="comma separated variants")
+    parser.add_argument("--repeat", type=int, default=3, help="timed runs, the best one is kept")
+    parser.add_argument("--csv", action="store_true", help="print comma separated values")
+    parser.add_argument("--keep", help="directory in which to keep the generated sources")
+    options = parser.parse_args()
+
+    compilers = [c for c in parse_list(options.compilers) if shutil.which(c)]
+    if not compilers:
+        sys.exit("No compiler found among " + options.compilers)
+
+    header = ["compiler", "variant", "kind", "N", "M", "wall_s", "peak_rss_mib", "instantiations"]
+    if options.csv:
+        print(",".join(header))
+    else:
+        print("{:<10} {:<8} {:<11} {:>4} {:>4} {:>8} {:>13} {:>15}".format(*header))
+
+    workdir = options.keep or tempfile.mkdtemp(prefix="bench_compile_")
+    os.makedirs(workdir, exist_ok=True)
+    try:
+        for compiler in compilers:
+            for variant in parse_list(options.variants):
+                flags = []
+                if variant == "module":
+                    if std_year(options.std) < 20:
+                        print("Skipping module, which needs --std c++20 or later", file=sys.stderr)
+                        continue
+                    flags, seconds = build_module(compiler, options.std, workdir)
+                    print("{} built the module in {:.3f} s".format(os.path.basename(compiler),
+                                                                   seconds), file=sys.stderr)
+                for kind in parse_list(options.kinds):
+                    for n in map(int, parse_list(options.forwarders)):
+                        for m in map(int, parse_list(options.overloads)):
+                            source = os.path.join(workdir, "{}_{}_{}_{}.cpp".format(variant, kind, n, m))
+                            with open(source, "w") as out:
+                                out.write(VARIANTS[variant](kind, n, m))
+                            runs = [measure(compiler, source, options.std, workdir, flags)
+                                    for _ in range(options.repeat)]
+                            wall = min(run[0] for run in runs)
+                            rss = max(run[1] for run in runs) / 1024.0
+                            count = count_instantiations(compiler, source, options.std, workdir,
+                                                         flags)
+                            row = [os.path.basename(compiler), variant, kind, n, m,
+                                   "{:.3f}".format(wall), "{:.1f}".format(rss), count]
+                            if options.csv:
+                                print(",".join(map(str, row)))
+                            else:
+                                print("{:<10} {:<8} {:<11} {:>4} {:>4} {:>8} {:>13} {:>15}".format(*row))
+                            sys.stdout.flush()
+    finally:
+        if not options.keep:
+            shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+/**
+ * Run-time benchmark of forwarded calls in builds without optimization.
+ *
+ * Calls a cheap method of a member held by value, by pointer and by shared_ptr directly on the
+ * member and through a FORWARD_TO_MEMBER_AS function. The best of several runs is reported for
+ * each as nanoseconds per call along with the overhead of forwarding. `make bench-debug` builds it
+ * at -O0 and -Og, with and without FORWARD_TO_MEMBER_ALWAYS_INLINE: without it every layer between
+ * the exposed function and the member function is a call of its own at -O0, with it the forwarded
+ * call should cost the same as the direct one.
+ *
+ * Usage: bench_debug [calls] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include "forward_to_member.hpp"
+
+/**
+ * Member whose method is kept out of line so that both variants make the same call at -Og.
+ */
+struct sensor
+{
+    long offset;
+    __attribute__((noinline)) long read(long raw) const { return raw + offset; }
+};
+
+struct device
+{
+    sensor value;
+    sensor* pointer;
+    std::shared_ptr<sensor> shared;
+
+    FORWARD_TO_MEMBER_AS(value, read, value_read);
+    FORWARD_TO_MEMBER_AS(pointer, read, pointer_read);
+    FORWARD_TO_MEMBER_AS(shared, read, shared_read);
+};
+
+/**
+ * Returns the best wall time in nanoseconds per call of repeat runs each making calls with call.
+ */
+template<typename Call>
+double best_of(int repeat, long calls, const device& d, Call call)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        long sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < calls; ++j)
+        {
+            sink += call(d, j);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        volatile long keep = sink;
+        (void)keep;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best / calls;
+}
+
+void report(const char* member, double direct, double forwarded)
+{
+    std::printf("%-11s %12.2f %12.2f %12.2f\n", member, direct, forwarded, forwarded - direct);
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 20000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    sensor pointed{2};
+    const device d{sensor{1}, &pointed, std::make_shared<sensor>(sensor{3})};
+
+#if defined(__OPTIMIZE__)
+    const char* optimization = "optimized";
+#else
+    const char* optimization = "not optimized";
+#endif
+#if defined(FORWARD_TO_MEMBER_ALWAYS_INLINE)
+    const char* mode = "FORWARD_TO_MEMBER_ALWAYS_INLINE";
+#else
+    const char* mode = "default";
+#endif
+    std::printf("%s, %s mode, %ld calls, best of %d runs\n", optimization, mode, calls, repeat);
+    std::printf("%-11s %12s %12s %12s\n", "member", "direct ns", "forwarded ns", "overhead ns");
+
+    // Every call passes an rvalue, as bench_instrument does, so both variants do the same work.
+    auto value = [](const device& x, long raw) { return x.value.read(raw + 0); };
+    auto value_forwarded = [](const device& x, long raw) { return x.value_read(raw + 0); };
+    auto pointer = [](const device& x, long raw) { return x.pointer->read(raw + 0); };
+    auto pointer_forwarded = [](const device& x, long raw) { return x.pointer_read(raw + 0); };
+    auto shared = [](const device& x, long raw) { return x.shared->read(raw + 0); };
+    auto shared_forwarded = [](const device& x, long raw) { return x.shared_read(raw + 0); };
+    report("value", best_of(repeat, calls, d, value), best_of(repeat, calls, d, value_forwarded));
+    report("pointer", best_of(repeat, calls, d, pointer),
+           best_of(repeat, calls, d, pointer_forwarded));
+    report("shared_ptr", best_of(repeat, calls, d, shared),
+           best_of(repeat, calls, d, shared_forwarded));
+    return 0;
+}
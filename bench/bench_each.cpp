@@ -0,0 +1,105 @@
+/**
+ * Run-time benchmark for FORWARD_TO_EACH_MEMBER.
+ *
+ * Calls a const method on each of 10^6 elements of a vector member, storing the results, with a
+ * hand-written loop, the sequential fan-out and the parallel fan-out with several grain sizes. The
+ * best of several runs is reported for each, along with its speedup over the hand-written loop.
+ *
+ * Usage: bench_each [elements] [repeat]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "forward_to_member_each.hpp"
+
+/**
+ * Element whose method does a little floating point work so that the cost of a call is not
+ * negligible compared with the cost of storing its result.
+ */
+struct particle
+{
+    double x;
+    double y;
+
+    double energy(double scale) const
+    {
+        double e = 0;
+        for (int i = 1; i <= 16; ++i)
+        {
+            e += std::sqrt(x * x * i + y * y) * scale / i;
+        }
+        return e;
+    }
+};
+
+struct system_of_particles
+{
+    std::vector<particle> particles;
+    FORWARD_TO_EACH_MEMBER(particles, energy, energies);
+};
+
+/**
+ * Returns the best wall time in milliseconds of repeat runs of run.
+ */
+template<typename Run>
+double best_of(int repeat, Run run)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    system_of_particles s;
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        s.particles.push_back(particle{i * 0.5, i * 0.25});
+    }
+    std::vector<double> results(elements);
+
+    std::printf("%zu elements, %u hardware threads, best of %d runs\n", elements,
+                std::thread::hardware_concurrency(), repeat);
+    std::printf("%-22s %10s %8s\n", "variant", "ms", "speedup");
+
+    const double hand = best_of(repeat, [&]()
+    {
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            results[i] = s.particles[i].energy(2.0);
+        }
+    });
+    std::printf("%-22s %10.2f %8.2f\n", "hand-written", hand, 1.0);
+
+    const double sequential = best_of(repeat, [&]()
+    {
+        s.energies(forward_to_member::sequential().into(results.begin()), 2.0);
+    });
+    std::printf("%-22s %10.2f %8.2f\n", "sequential", sequential, hand / sequential);
+
+    for (std::size_t grain : {256, 4096, 65536})
+    {
+        const double parallel = best_of(repeat, [&]()
+        {
+            s.energies(forward_to_member::parallel(grain).into(results.begin()), 2.0);
+        });
+        char name[32];
+        std::snprintf(name, sizeof(name), "parallel grain %zu", grain);
+        std::printf("%-22s %10.2f %8.2f\n", name, parallel, hand / parallel);
+    }
+    return 0;
+}
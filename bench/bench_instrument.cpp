@@ -0,0 +1,114 @@
+/**
+ * Run-time benchmark of the instrumentation of forwarded functions.
+ *
+ * Built with FORWARD_TO_MEMBER_INSTRUMENT, it calls a cheap const method through a hand-written
+ * forwarding method, which is what an uninstrumented forwarded function compiles to (see
+ * codegen_test), and through an instrumented FORWARD_TO_MEMBER_AS function, from increasing numbers
+ * of threads. The best of several runs is reported for each as nanoseconds per call per thread
+ * along with the overhead of the instrumentation, most of which is reading the clock twice, whose
+ * cost is reported too. The overhead should not grow with the number of threads since every thread
+ * counts into its own cache lines.
+ *
+ * Usage: bench_instrument [calls per thread] [repeat] [max threads]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "forward_to_member.hpp"
+
+/**
+ * Member whose method is kept out of line so that both variants make the same call.
+ */
+struct sensor
+{
+    long offset;
+    __attribute__((noinline)) long read(long raw) const { return raw + offset; }
+};
+
+struct device
+{
+    sensor s;
+    FORWARD_TO_MEMBER_AS(s, read, read);
+
+    long read_direct(long raw) const { return s.read(raw); }
+};
+
+/**
+ * Returns the best wall time in nanoseconds per call of repeat runs of threads each making calls
+ * with call.
+ */
+template<typename Call>
+double best_of(int repeat, unsigned threads, long calls, Call call)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]()
+            {
+                device d{sensor{1}};
+                long sink = 0;
+                for (long j = 0; j < calls; ++j)
+                {
+                    sink += call(d, j);
+                }
+                volatile long keep = sink;
+                (void)keep;
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best / calls;
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 10000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+    const unsigned max_threads = argc > 3 ? std::atoi(argv[3]) : 4;
+
+    std::printf("%ld calls per thread, %u hardware threads, best of %d runs\n", calls,
+                std::thread::hardware_concurrency(), repeat);
+    long ticks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < calls; ++i)
+    {
+        ticks += std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+    std::chrono::duration<double, std::nano> clock = std::chrono::steady_clock::now() - start;
+    volatile long keep = ticks;
+    (void)keep;
+    std::printf("steady_clock::now %.2f ns, twice per instrumented call\n", clock.count() / calls);
+
+    std::printf("%8s %14s %14s %14s\n", "threads", "direct ns", "instrumented", "overhead ns");
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        const double direct = best_of(repeat, threads, calls, [](const device& d, long raw)
+        {
+            return d.read_direct(raw);
+        });
+        const double instrumented = best_of(repeat, threads, calls, [](const device& d, long raw)
+        {
+            return d.read(raw + 0);
+        });
+        std::printf("%8u %14.2f %14.2f %14.2f\n", threads, direct, instrumented,
+                    instrumented - direct);
+    }
+    forward_to_member::write_instrumentation_report(std::cout);
+    return 0;
+}
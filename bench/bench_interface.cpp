@@ -0,0 +1,194 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_INTERFACE.
+ *
+ * Builds a vector of 10^6 shapes of three types in a pseudo-random order, once as
+ * std::unique_ptr to an abstract base class and once as interface values, then sums their areas,
+ * calling a const method on each shape. The best of several runs of each is reported in
+ * nanoseconds per shape, along with the speedup of the interface values over the virtual calls.
+ *
+ * Usage: bench_interface [shapes] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "forward_to_member_interface.hpp"
+
+FORWARD_TO_MEMBER_INTERFACE(shape, (area, double() const));
+
+struct base
+{
+    virtual ~base() = default;
+    virtual double area() const = 0;
+};
+
+struct circle
+{
+    double r;
+    double area() const { return 3.14159 * r * r; }
+};
+
+struct square
+{
+    double side;
+    double area() const { return side * side; }
+};
+
+struct triangle
+{
+    double b;
+    double h;
+    double area() const { return b * h / 2; }
+};
+
+/**
+ * Virtual versions of the shapes.
+ */
+struct virtual_circle : public base, public circle
+{
+    explicit virtual_circle(double r) : circle{r} { }
+    double area() const override { return circle::area(); }
+};
+
+struct virtual_square : public base, public square
+{
+    explicit virtual_square(double side) : square{side} { }
+    double area() const override { return square::area(); }
+};
+
+struct virtual_triangle : public base, public triangle
+{
+    explicit virtual_triangle(double b, double h) : triangle{b, h} { }
+    double area() const override { return triangle::area(); }
+};
+
+/**
+ * Kinds of count shapes, from a linear congruential generator so the branch predictor can't guess
+ * the type of the next one.
+ */
+std::vector<unsigned char> kinds(long count)
+{
+    std::vector<unsigned char> k(count);
+    unsigned state = 1;
+    for (long i = 0; i < count; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        k[i] = (state >> 16) % 3;
+    }
+    return k;
+}
+
+void add(std::vector<std::unique_ptr<base>>& shapes, unsigned k, double x)
+{
+    if (k == 0)
+    {
+        shapes.emplace_back(new virtual_circle(x));
+    }
+    else if (k == 1)
+    {
+        shapes.emplace_back(new virtual_square(x));
+    }
+    else
+    {
+        shapes.emplace_back(new virtual_triangle(x, x));
+    }
+}
+
+void add(std::vector<shape>& shapes, unsigned k, double x)
+{
+    if (k == 0)
+    {
+        shapes.emplace_back(circle{x});
+    }
+    else if (k == 1)
+    {
+        shapes.emplace_back(square{x});
+    }
+    else
+    {
+        shapes.emplace_back(triangle{x, x});
+    }
+}
+
+double area(const std::unique_ptr<base>& s)
+{
+    return s->area();
+}
+
+double area(const shape& s)
+{
+    return s.area();
+}
+
+struct timing
+{
+    double construct_ns;
+    double call_ns;
+};
+
+/**
+ * Returns the best times per shape of repeat runs building shapes of the given kinds into a vector
+ * of S and summing their areas. The vector is reused so only the first run pays for page faults.
+ */
+template<typename S>
+timing best_of(int repeat, const std::vector<unsigned char>& kinds)
+{
+    const long count = static_cast<long>(kinds.size());
+    timing best = {0, 0};
+    std::vector<S> shapes;
+    shapes.reserve(count);
+    for (int i = 0; i < repeat; ++i)
+    {
+        shapes.clear();
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < count; ++j)
+        {
+            add(shapes, kinds[j], 1 + j % 7);
+        }
+        auto built = std::chrono::steady_clock::now();
+        double sum = 0;
+        for (const S& s : shapes)
+        {
+            sum += area(s);
+        }
+        auto summed = std::chrono::steady_clock::now();
+        if (sum <= 0)
+        {
+            std::fprintf(stderr, "no area\n");
+            std::exit(1);
+        }
+        std::chrono::duration<double, std::nano> construct = built - start;
+        std::chrono::duration<double, std::nano> call = summed - built;
+        if (i == 0 || construct.count() / count < best.construct_ns)
+        {
+            best.construct_ns = construct.count() / count;
+        }
+        if (i == 0 || call.count() / count < best.call_ns)
+        {
+            best.call_ns = call.count() / count;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    const long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::printf("%ld shapes, best of %d runs, ns per shape\n", count, repeat);
+    std::printf("%-22s %10s %10s\n", "variant", "construct", "call");
+
+    const std::vector<unsigned char> order = kinds(count);
+    const timing virtual_calls = best_of<std::unique_ptr<base>>(repeat, order);
+    const timing interface = best_of<shape>(repeat, order);
+    std::printf("%-22s %10.2f %10.2f\n", "unique_ptr<base>", virtual_calls.construct_ns,
+                virtual_calls.call_ns);
+    std::printf("%-22s %10.2f %10.2f\n", "interface", interface.construct_ns, interface.call_ns);
+    std::printf("%-22s %10.2f %10.2f\n", "speedup",
+                virtual_calls.construct_ns / interface.construct_ns,
+                virtual_calls.call_ns / interface.call_ns);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * Contention benchmark for FORWARD_TO_MEMBER_LOCKED.
+ *
+ * Threads call a const method of a member guarded by each lock policy, with a share of the calls
+ * going to a non-const method instead, and the total throughput is reported for increasing numbers
+ * of threads. With reader-writer mutexes the const calls take shared locks and throughput scales
+ * with the number of cores, while exclusive mutexes serialize them.
+ *
+ * Usage: bench_locked [calls per thread] [percent of writes] [max threads]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <shared_mutex>
+#endif
+#include "forward_to_member_locked.hpp"
+
+/**
+ * Member whose const method does enough work for the time spent under the lock to matter.
+ */
+struct histogram
+{
+    long bins[64] = {};
+
+    long total() const
+    {
+        long sum = 0;
+        for (long bin : bins)
+        {
+            sum += bin;
+        }
+        return sum;
+    }
+
+    void add(unsigned bin) { ++bins[bin % 64]; }
+};
+
+#define GUARDED_HISTOGRAM(name, mutex_type)                                                        \
+    struct name                                                                                    \
+    {                                                                                              \
+        mutable mutex_type mutex;                                                                  \
+        histogram h;                                                                               \
+        FORWARD_TO_MEMBER_LOCKED(h, total, total, mutex);                                          \
+        FORWARD_TO_MEMBER_LOCKED(h, add, add, mutex);                                              \
+    }
+
+GUARDED_HISTOGRAM(none_histogram, forward_to_member::null_mutex);
+GUARDED_HISTOGRAM(mutex_histogram, std::mutex);
+GUARDED_HISTOGRAM(spinlock_histogram, forward_to_member::spinlock);
+GUARDED_HISTOGRAM(shared_spinlock_histogram, forward_to_member::shared_spinlock);
+#if __cplusplus >= 201703L
+GUARDED_HISTOGRAM(shared_mutex_histogram, std::shared_mutex);
+#endif
+
+/**
+ * Returns the throughput in millions of calls per second of threads each making calls, one in
+ * every 100 / percent of them a write.
+ */
+template<typename Guarded>
+double run(unsigned threads, long calls, long percent)
+{
+    Guarded g;
+    const Guarded& reader = g;
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+        {
+            long sink = 0;
+            for (long i = 0; i < calls; ++i)
+            {
+                if (percent && i % 100 < percent)
+                {
+                    g.add(static_cast<unsigned>(i + t));
+                }
+                else
+                {
+                    sink += reader.total();
+                }
+            }
+            volatile long keep = sink;
+            (void)keep;
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return threads * calls / elapsed.count();
+}
+
+template<typename Guarded>
+void report(const char* name, unsigned max_threads, long calls, long percent)
+{
+    std::printf("%-16s", name);
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %10.2f", run<Guarded>(threads, calls, percent));
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const long percent = argc > 2 ? std::atol(argv[2]) : 0;
+    const unsigned max_threads = argc > 3 ? std::atoi(argv[3]) : 8;
+
+    std::printf("%ld calls per thread, %ld%% writes, %u hardware threads, Mcalls/s\n", calls,
+                percent, std::thread::hardware_concurrency());
+    std::printf("%-16s", "policy");
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %7u thr", threads);
+    }
+    std::printf("\n");
+
+    if (!percent)
+    {
+        report<none_histogram>("none", max_threads, calls, percent);
+    }
+    report<mutex_histogram>("std::mutex", max_threads, calls, percent);
+    report<spinlock_histogram>("spinlock", max_threads, calls, percent);
+    report<shared_spinlock_histogram>("shared_spinlock", max_threads, calls, percent);
+#if __cplusplus >= 201703L
+    report<shared_mutex_histogram>("shared_mutex", max_threads, calls, percent);
+#endif
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_MEMO.
+ *
+ * Calls an expensive const method of a member 20000 times with arguments cycling through a number
+ * of distinct values, through plain forwarding and through memoized forwarding. With fewer
+ * distinct values than the cache holds nearly every call is a hit; with many more, nearly every
+ * call is a miss and the cost of the cache is added to that of the method. The best of several
+ * runs is reported for each, along with the hit rate and the speedup over plain forwarding.
+ *
+ * Usage: bench_memo [calls] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "forward_to_member_memo.hpp"
+
+/**
+ * Member computing a derived value from its arguments, here the number of primes below a limit.
+ */
+struct primes
+{
+    long count_below(long limit) const
+    {
+        long count = 0;
+        for (long i = 2; i < limit; ++i)
+        {
+            bool prime = true;
+            for (long d = 2; d * d <= i && prime; ++d)
+            {
+                prime = i % d != 0;
+            }
+            count += prime;
+        }
+        return count;
+    }
+};
+
+struct plain
+{
+    primes p;
+    FORWARD_TO_MEMBER(p, count_below);
+};
+
+struct memoized
+{
+    primes p;
+    FORWARD_TO_MEMBER_MEMO(p, count_below, count_below);
+};
+
+/**
+ * Returns the best wall time in milliseconds of repeat runs of calls calls on a fresh W, with
+ * arguments cycling through distinct values.
+ */
+template<typename W>
+double best_of(int repeat, long calls, long distinct, W*& last)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        delete last;
+        last = new W();
+        const W& w = *last;
+        long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < calls; ++j)
+        {
+            sum += w.count_below(500 + j % distinct);
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (sum <= 0)
+        {
+            std::fprintf(stderr, "no primes\n");
+            std::exit(1);
+        }
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+void report(int repeat, long calls, long distinct)
+{
+    plain* p = nullptr;
+    memoized* m = nullptr;
+    const double plain_ms = best_of(repeat, calls, distinct, p);
+    const double memo_ms = best_of(repeat, calls, distinct, m);
+    const forward_to_member::memo_stats stats = m->memo_stats_count_below();
+    std::printf("%8ld %10.2f %10.2f %8.1f%% %8.2f\n", distinct, plain_ms, memo_ms,
+                100.0 * stats.hits / (stats.hits + stats.misses), plain_ms / memo_ms);
+    delete p;
+    delete m;
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 20000;
+    const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::printf("%ld calls, best of %d runs, cache of %zu results\n", calls, repeat,
+                forward_to_member::default_memo_capacity);
+    std::printf("%8s %10s %10s %9s %8s\n", "distinct", "plain ms", "memo ms", "hits", "speedup");
+    report(repeat, calls, 1);
+    report(repeat, calls, 16);
+    report(repeat, calls, 48);
+    report(repeat, calls, 1024);
+    return 0;
+}
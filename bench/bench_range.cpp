@@ -0,0 +1,141 @@
+/**
+ * Run-time benchmark for FORWARD_TO_MEMBER_RANGE and FORWARD_TO_MEMBER_OPERATOR.
+ *
+ * Sums a vector of ints held by value, by pointer and by shared_ptr, with a range-based for loop,
+ * an indexed loop and std::accumulate, once over the member directly and once over a const object
+ * exposing its range and subscript operator. The best of several runs of each is reported in
+ * nanoseconds per element: the forwarded loops should run at the same speed as the direct ones, as
+ * they compile to the same code.
+ *
+ * Usage: bench_range [elements] [passes] [repeat]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include "forward_to_member.hpp"
+
+struct value_samples
+{
+    std::vector<int> v;
+    FORWARD_TO_MEMBER_RANGE(v);
+    FORWARD_TO_MEMBER_OPERATOR(v, []);
+};
+
+struct pointer_samples
+{
+    std::vector<int>* v;
+    FORWARD_TO_MEMBER_RANGE(v);
+    FORWARD_TO_MEMBER_OPERATOR(v, []);
+};
+
+struct shared_samples
+{
+    std::shared_ptr<std::vector<int>> v;
+    FORWARD_TO_MEMBER_RANGE(v);
+    FORWARD_TO_MEMBER_OPERATOR(v, []);
+};
+
+/**
+ * The three loops summing a range r, which is either a vector or an object exposing one. They are
+ * kept out of line so that each is timed as the same code wherever it is called from.
+ */
+template<typename R>
+__attribute__((noinline)) long sum_range_for(const R& r)
+{
+    long sum = 0;
+    for (int i : r)
+    {
+        sum += i;
+    }
+    return sum;
+}
+
+template<typename R>
+__attribute__((noinline)) long sum_indexed(const R& r)
+{
+    long sum = 0;
+    for (std::size_t i = 0, size = r.size(); i < size; ++i)
+    {
+        sum += r[i];
+    }
+    return sum;
+}
+
+template<typename R>
+__attribute__((noinline)) long sum_accumulate(const R& r)
+{
+    return std::accumulate(r.begin(), r.end(), 0L);
+}
+
+/**
+ * Returns the best wall time in nanoseconds per element of repeat runs each making passes calls to
+ * sum on a range of elements. The data sum reads is changed between passes through touch, so the
+ * sums can't be hoisted out of the loop.
+ */
+template<typename Sum, typename Touch>
+double best_of(int repeat, long passes, long elements, Sum sum, Touch touch)
+{
+    double best = 0;
+    for (int i = 0; i < repeat; ++i)
+    {
+        long sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long j = 0; j < passes; ++j)
+        {
+            touch(j);
+            sink += sum();
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        volatile long keep = sink;
+        (void)keep;
+        if (i == 0 || elapsed.count() < best)
+        {
+            best = elapsed.count();
+        }
+    }
+    return best / (passes * elements);
+}
+
+void report(const char* member, const char* loop, double direct, double forwarded)
+{
+    std::printf("%-11s %-15s %10.3f %12.3f\n", member, loop, direct, forwarded);
+}
+
+int main(int argc, char** argv)
+{
+    const long elements = argc > 1 ? std::atol(argv[1]) : 4096;
+    const long passes = argc > 2 ? std::atol(argv[2]) : 50000;
+    const int repeat = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    std::vector<int> pointed(elements);
+    std::iota(pointed.begin(), pointed.end(), 0);
+    value_samples value{pointed};
+    pointer_samples pointer{&pointed};
+    shared_samples shared{std::make_shared<std::vector<int>>(pointed)};
+
+    std::printf("%ld elements, %ld passes, best of %d runs\n", elements, passes, repeat);
+    std::printf("%-11s %-15s %10s %12s\n", "member", "loop", "direct ns", "forwarded ns");
+
+    // Each loop is timed over the vector itself and over the object exposing it, both as const.
+#define BENCH_RANGE(name, object, direct, loop)                                                    \
+    report(name, #loop,                                                                            \
+           best_of(repeat, passes, elements, [&]() { return loop(direct); },                       \
+                   [&](long j) { ++(direct)[j % elements]; }),                                     \
+           best_of(repeat, passes, elements, [&]() { return loop(object); },                       \
+                   [&](long j) { ++(object)[j % elements]; }))
+    BENCH_RANGE("value", value, value.v, sum_range_for);
+    BENCH_RANGE("value", value, value.v, sum_indexed);
+    BENCH_RANGE("value", value, value.v, sum_accumulate);
+    BENCH_RANGE("pointer", pointer, *pointer.v, sum_range_for);
+    BENCH_RANGE("pointer", pointer, *pointer.v, sum_indexed);
+    BENCH_RANGE("pointer", pointer, *pointer.v, sum_accumulate);
+    BENCH_RANGE("shared_ptr", shared, *shared.v, sum_range_for);
+    BENCH_RANGE("shared_ptr", shared, *shared.v, sum_indexed);
+    BENCH_RANGE("shared_ptr", shared, *shared.v, sum_accumulate);
+#undef BENCH_RANGE
+    return 0;
+}
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Code-size report for forward_to_member.hpp.
+
+Generates a synthetic translation unit in which C classes each forward the same N methods, each
+having M overloads spread across every cv class, to a member of the given kind, and calls every
+forwarder. The translation unit is compiled with -g at each optimization level and the size of the
+object's code and data (its text, rodata, data and bss sections), the size of its debug information
+(its .debug_ sections) and the number of symbols it defines are reported.
+
+--root selects the tree whose headers are used, so two revisions can be compared, e.g. with the
+tree of the previous revision checked out by git worktree.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+from bench_compile import ROOT, generate_target, method_name, parse_list
+
+# Declaration and initializer, from the target t, of the member for each kind.
+KINDS = {
+    "value":      ("target m;",                  "m(t)"),
+    "pointer":    ("target* m;",                 "m(&t)"),
+    "shared_ptr": ("std::shared_ptr<target> m;", "m(std::make_shared<target>(t))"),
+}
+
+
+def generate(kind, classes, forwarders, overloads):
+    declaration, initializer = KINDS[kind]
+    lines = ["#include <memory>", '#include "forward_to_member.hpp"', ""]
+    lines += generate_target(forwarders, overloads)
+    for c in range(classes):
+        lines += ["", "struct wrapper{}".format(c), "{", "    " + declaration]
+        lines += ["    FORWARD_TO_MEMBER_AS(m, {0}, {0});".format(method_name(i))
+                  for i in range(forwarders)]
+        lines += ["    wrapper{}(target& t) : {} {{ }}".format(c, initializer), "};"]
+    lines += ["", "int use(target& t)", "{", "    int r = 0;"]
+    for c in range(classes):
+        lines.append("    wrapper{0} w{0}(t);".format(c))
+        for i in range(forwarders):
+            for j in range(overloads):
+                # Every exposed function can be called on a non-const, non-volatile object.
+                args = ", ".join(str(k) for k in range(j + 1))
+                lines.append("    r += w{}.{}({});".format(c, method_name(i), args))
+    lines += ["    return r;", "}"]
+    return "\n".join(lines) + "\n"
+
+
+def sections(obj):
+    """Returns the sizes of the sections of an object as reported by size -A."""
+    output = subprocess.check_output(["size", "-A", obj], universal_newlines=True)
+    result = {}
+    for line in output.splitlines():
+        match = re.match(r"^(\.\S+)\s+(\d+)\s+\d+$", line)
+        if match:
+            result[match.group(1)] = result.get(match.group(1), 0) + int(match.group(2))
+    return result
+
+
+def measure(compiler, std, root, source, opt, workdir):
+    """Returns (code and data bytes, debug info bytes, defined symbols) of an object."""
+    obj = os.path.join(workdir, "size.o")
+    subprocess.check_call([compiler, "-std=" + std, "-I" + root, opt, "-g", "-c", source,
+                           "-o", obj])
+    sizes = sections(obj)
+    code = sum(size for name, size in sizes.items()
+               if re.match(r"^\.(text|data|bss|rodata)", name))
+    debug = sum(size for name, size in sizes.items() if name.startswith(".debug_"))
+    symbols = subprocess.check_output(["nm", "--defined-only", obj], universal_newlines=True)
+    return code, debug, len(symbols.splitlines())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--std", default="c++11")
+    parser.add_argument("--root", default=ROOT, help="tree holding the headers to measure")
+    parser.add_argument("--classes", default="1,8", help="comma separated values of C")
+    parser.add_argument("--forwarders", type=int, default=4, help="N")
+    parser.add_argument("--overloads", type=int, default=4, help="M")
+    parser.add_argument("--kinds", default=",".join(KINDS), help="comma separated member kinds")
+    parser.add_argument("--opts", default="-O0,-O2", help="comma separated optimization levels")
+    parser.add_argument("--csv", action="store_true", help="print comma separated values")
+    options = parser.parse_args()
+
+    if not shutil.which(options.compiler):
+        sys.exit("No compiler " + options.compiler)
+
+    header = ["opt", "kind", "C", "code_bytes", "debug_bytes", "symbols"]
+    row_format = "{:<4} {:<11} {:>3} {:>11} {:>12} {:>8}"
+    print(",".join(header) if options.csv else row_format.format(*header))
+
+    workdir = tempfile.mkdtemp(prefix="bench_size_")
+    try:
+        for opt in parse_list(options.opts):
+            for kind in parse_list(options.kinds):
+                for classes in map(int, parse_list(options.classes)):
+                    source = os.path.join(workdir, "{}_{}.cpp".format(kind, classes))
+                    with open(source, "w") as out:
+                        out.write(generate(kind, classes, options.forwarders, options.overloads))
+                    code, debug, symbols = measure(options.compiler, options.std,
+                                                   os.path.abspath(options.root), source, opt,
+                                                   workdir)
+                    row = [opt, kind, classes, code, debug, symbols]
+                    print(",".join(map(str, row)) if options.csv else row_format.format(*row))
+                    sys.stdout.flush()
+    finally:
+        shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
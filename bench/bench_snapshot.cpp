@@ -0,0 +1,151 @@
+/**
+ * Read-throughput benchmark for FORWARD_TO_MEMBER_SNAPSHOT.
+ *
+ * Threads read a configuration held through a shared_ptr while a writer thread publishes a new one
+ * every 100 microseconds. The configuration is guarded by a std::mutex or a std::shared_mutex
+ * through FORWARD_TO_MEMBER_LOCKED, or held in an atomic_snapshot and loaded per call or once per
+ * batch of 64 calls with a snapshot_scope. The total read throughput is reported for increasing
+ * numbers of threads.
+ *
+ * Usage: bench_snapshot [calls per thread] [max threads]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "forward_to_member_locked.hpp"
+#include "forward_to_member_snapshot.hpp"
+
+struct config
+{
+    long timeout;
+    long retries;
+
+    long budget() const { return timeout * retries; }
+};
+
+#define LOCKED_SERVICE(name, mutex_type)                                                           \
+    struct name                                                                                    \
+    {                                                                                              \
+        mutable mutex_type mutex;                                                                  \
+        std::shared_ptr<const config> settings = std::make_shared<const config>(config{1, 1});     \
+        FORWARD_TO_MEMBER_LOCKED(settings, budget, budget, mutex);                                 \
+                                                                                                   \
+        void reload(long timeout)                                                                  \
+        {                                                                                          \
+            std::shared_ptr<const config> next =                                                   \
+                std::make_shared<const config>(config{timeout, 1});                                \
+            std::lock_guard<mutex_type> lock(mutex);                                               \
+            settings.swap(next);                                                                   \
+        }                                                                                          \
+    }
+
+LOCKED_SERVICE(mutex_service, std::mutex);
+LOCKED_SERVICE(shared_mutex_service, std::shared_mutex);
+
+struct snapshot_service
+{
+    forward_to_member::atomic_snapshot<const config> settings{
+        std::make_shared<const config>(config{1, 1})};
+    FORWARD_TO_MEMBER_SNAPSHOT(settings, budget, budget);
+
+    void reload(long timeout)
+    {
+        settings.publish(std::make_shared<const config>(config{timeout, 1}));
+    }
+};
+
+/**
+ * Returns the read throughput in millions of calls per second of threads each making calls, in
+ * batches of batch calls under a snapshot_scope if Scoped is true.
+ */
+template<typename Service, bool Scoped>
+double run(unsigned threads, long calls)
+{
+    const long batch = 64;
+    Service s;
+    const Service& reader = s;
+    std::atomic<bool> done(false);
+    std::thread writer([&]()
+    {
+        for (long timeout = 2; !done; ++timeout)
+        {
+            s.reload(timeout);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&]()
+        {
+            long sink = 0;
+            for (long i = 0; i < calls; i += batch)
+            {
+                if (Scoped)
+                {
+                    forward_to_member::snapshot_scope scope;
+                    for (long j = 0; j < batch; ++j)
+                    {
+                        sink += reader.budget();
+                    }
+                }
+                else
+                {
+                    for (long j = 0; j < batch; ++j)
+                    {
+                        sink += reader.budget();
+                    }
+                }
+            }
+            volatile long keep = sink;
+            (void)keep;
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    done = true;
+    writer.join();
+    return threads * calls / elapsed.count();
+}
+
+template<typename Service, bool Scoped>
+void report(const char* name, unsigned max_threads, long calls)
+{
+    std::printf("%-18s", name);
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %10.2f", run<Service, Scoped>(threads, calls));
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    const long calls = argc > 1 ? std::atol(argv[1]) : 4000000;
+    const unsigned max_threads = argc > 2 ? std::atoi(argv[2]) : 8;
+
+    std::printf("%ld calls per thread, %u hardware threads, Mcalls/s\n", calls,
+                std::thread::hardware_concurrency());
+    std::printf("%-18s", "variant");
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::printf(" %7u thr", threads);
+    }
+    std::printf("\n");
+
+    report<mutex_service, false>("std::mutex", max_threads, calls);
+    report<shared_mutex_service, false>("std::shared_mutex", max_threads, calls);
+    report<snapshot_service, false>("snapshot per call", max_threads, calls);
+    report<snapshot_service, true>("snapshot per 64", max_threads, calls);
+    return 0;
+}
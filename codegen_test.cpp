@@ -0,0 +1,148 @@
+#include "forward_to_member.hpp"
+
+/**
+ * Same overload set as foo in forward_to_member_test.cpp, but the methods are only declared so that
+ * neither the hand-written nor the forwarded calls can be folded away. What remains is the cost of
+ * reaching the member, which is what the codegen test compares.
+ */
+struct foo
+{
+    int func1(int i);
+    int func1(int i, int j) volatile;
+    int func1(int i, int j, int k) const;
+    int func1(int i, int j, int k, int l) const volatile;
+};
+
+/**
+ * Holds a foo through each kind of member and exposes every overload twice, once forwarded with
+ * FORWARD_TO_MEMBER_AS and once written out by hand.
+ */
+struct bar
+{
+    foo f;
+    FORWARD_TO_MEMBER_AS(f, func1, f_func1);
+    int hand_f_func1(int i) { return f.func1(i); }
+    int hand_f_func1(int i, int j) volatile { return f.func1(i, j); }
+    int hand_f_func1(int i, int j, int k) const { return f.func1(i, j, k); }
+    int hand_f_func1(int i, int j, int k, int l) const volatile { return f.func1(i, j, k, l); }
+
+    foo& fr;
+    FORWARD_TO_MEMBER_AS(fr, func1, fr_func1);
+    int hand_fr_func1(int i) { return fr.func1(i); }
+    int hand_fr_func1(int i, int j) volatile { return fr.func1(i, j); }
+    int hand_fr_func1(int i, int j, int k) const { return fr.func1(i, j, k); }
+    int hand_fr_func1(int i, int j, int k, int l) const volatile { return fr.func1(i, j, k, l); }
+
+    foo* fp;
+    FORWARD_TO_MEMBER_AS(fp, func1, fp_func1);
+    int hand_fp_func1(int i) { return fp->func1(i); }
+    int hand_fp_func1(int i, int j) volatile { return fp->func1(i, j); }
+    int hand_fp_func1(int i, int j, int k) const { return fp->func1(i, j, k); }
+    int hand_fp_func1(int i, int j, int k, int l) const volatile { return fp->func1(i, j, k, l); }
+
+    std::shared_ptr<foo> fsp;
+    FORWARD_TO_MEMBER_AS(fsp, func1, fsp_func1);
+    int hand_fsp_func1(int i) { return fsp->func1(i); }
+    int hand_fsp_func1(int i, int j) { return fsp->func1(i, j); }
+    int hand_fsp_func1(int i, int j, int k) const { return fsp->func1(i, j, k); }
+    int hand_fsp_func1(int i, int j, int k, int l) const { return fsp->func1(i, j, k, l); }
+
+    std::unique_ptr<foo> fup;
+    FORWARD_TO_MEMBER_AS(fup, func1, fup_func1);
+    int hand_fup_func1(int i) { return fup->func1(i); }
+    int hand_fup_func1(int i, int j) { return fup->func1(i, j); }
+    int hand_fup_func1(int i, int j, int k) const { return fup->func1(i, j, k); }
+    int hand_fup_func1(int i, int j, int k, int l) const { return fup->func1(i, j, k, l); }
+};
+
+/**
+ * Holds a foo through a value, a pointer and a shared pointer, as the middle of the paths of baz.
+ */
+struct hop
+{
+    foo f;
+    foo* fp;
+    std::shared_ptr<foo> fsp;
+};
+
+/**
+ * Reaches a foo along paths of two members mixing kinds and exposes every overload twice, once
+ * forwarded with FORWARD_TO_MEMBER_PATH and once written out by hand as a single expression.
+ */
+struct baz
+{
+    hop h;
+    hop* hp;
+    std::shared_ptr<hop> hsp;
+
+    FORWARD_TO_MEMBER_PATH((h, fp), func1, h_fp_func1);
+    int hand_h_fp_func1(int i) { return h.fp->func1(i); }
+    int hand_h_fp_func1(int i, int j) volatile { return h.fp->func1(i, j); }
+    int hand_h_fp_func1(int i, int j, int k) const { return h.fp->func1(i, j, k); }
+    int hand_h_fp_func1(int i, int j, int k, int l) const volatile
+        { return h.fp->func1(i, j, k, l); }
+
+    FORWARD_TO_MEMBER_PATH((hp, f), func1, hp_f_func1);
+    int hand_hp_f_func1(int i) { return hp->f.func1(i); }
+    int hand_hp_f_func1(int i, int j) volatile { return hp->f.func1(i, j); }
+    int hand_hp_f_func1(int i, int j, int k) const { return hp->f.func1(i, j, k); }
+    int hand_hp_f_func1(int i, int j, int k, int l) const volatile
+        { return hp->f.func1(i, j, k, l); }
+
+    FORWARD_TO_MEMBER_PATH((hsp, fp), func1, hsp_fp_func1);
+    int hand_hsp_fp_func1(int i) { return hsp->fp->func1(i); }
+    int hand_hsp_fp_func1(int i, int j) { return hsp->fp->func1(i, j); }
+    int hand_hsp_fp_func1(int i, int j, int k) const { return hsp->fp->func1(i, j, k); }
+    int hand_hsp_fp_func1(int i, int j, int k, int l) const { return hsp->fp->func1(i, j, k, l); }
+
+    FORWARD_TO_MEMBER_PATH((hp, fsp), func1, hp_fsp_func1);
+    int hand_hp_fsp_func1(int i) { return hp->fsp->func1(i); }
+    int hand_hp_fsp_func1(int i, int j) { return hp->fsp->func1(i, j); }
+    int hand_hp_fsp_func1(int i, int j, int k) const { return hp->fsp->func1(i, j, k); }
+    int hand_hp_fsp_func1(int i, int j, int k, int l) const { return hp->fsp->func1(i, j, k, l); }
+};
+
+/**
+ * Emits a hand-written and a forwarded out-of-line function for one overload called through one
+ * kind of bar reference. The codegen_test script pairs them up by name.
+ */
+#define CODEGEN_PAIR(name, object, forwarder, ...)                                   \
+    extern "C" int hand_##name(object& b) { return b.hand_##forwarder(__VA_ARGS__); } \
+    extern "C" int forwarded_##name(object& b) { return b.forwarder(__VA_ARGS__); }
+
+CODEGEN_PAIR(value_plain,         bar,                f_func1,   1)
+CODEGEN_PAIR(value_volatile,      volatile bar,       f_func1,   1, 2)
+CODEGEN_PAIR(value_const,         const bar,          f_func1,   1, 2, 3)
+CODEGEN_PAIR(value_cv,            const volatile bar, f_func1,   1, 2, 3, 4)
+CODEGEN_PAIR(reference_plain,     bar,                fr_func1,  1)
+CODEGEN_PAIR(reference_volatile,  volatile bar,       fr_func1,  1, 2)
+CODEGEN_PAIR(reference_const,     const bar,          fr_func1,  1, 2, 3)
+CODEGEN_PAIR(reference_cv,        const volatile bar, fr_func1,  1, 2, 3, 4)
+CODEGEN_PAIR(pointer_plain,       bar,                fp_func1,  1)
+CODEGEN_PAIR(pointer_volatile,    volatile bar,       fp_func1,  1, 2)
+CODEGEN_PAIR(pointer_const,       const bar,          fp_func1,  1, 2, 3)
+CODEGEN_PAIR(pointer_cv,          const volatile bar, fp_func1,  1, 2, 3, 4)
+CODEGEN_PAIR(shared_ptr_plain,    bar,                fsp_func1, 1)
+CODEGEN_PAIR(shared_ptr_volatile, bar,                fsp_func1, 1, 2)
+CODEGEN_PAIR(shared_ptr_const,    const bar,          fsp_func1, 1, 2, 3)
+CODEGEN_PAIR(shared_ptr_cv,       const bar,          fsp_func1, 1, 2, 3, 4)
+CODEGEN_PAIR(unique_ptr_plain,    bar,                fup_func1, 1)
+CODEGEN_PAIR(unique_ptr_volatile, bar,                fup_func1, 1, 2)
+CODEGEN_PAIR(unique_ptr_const,    const bar,          fup_func1, 1, 2, 3)
+CODEGEN_PAIR(unique_ptr_cv,       const bar,          fup_func1, 1, 2, 3, 4)
+CODEGEN_PAIR(value_pointer_plain,           baz,                h_fp_func1,   1)
+CODEGEN_PAIR(value_pointer_volatile,        volatile baz,       h_fp_func1,   1, 2)
+CODEGEN_PAIR(value_pointer_const,           const baz,          h_fp_func1,   1, 2, 3)
+CODEGEN_PAIR(value_pointer_cv,              const volatile baz, h_fp_func1,   1, 2, 3, 4)
+CODEGEN_PAIR(pointer_value_plain,           baz,                hp_f_func1,   1)
+CODEGEN_PAIR(pointer_value_volatile,        volatile baz,       hp_f_func1,   1, 2)
+CODEGEN_PAIR(pointer_value_const,           const baz,          hp_f_func1,   1, 2, 3)
+CODEGEN_PAIR(pointer_value_cv,              const volatile baz, hp_f_func1,   1, 2, 3, 4)
+CODEGEN_PAIR(shared_ptr_pointer_plain,      baz,                hsp_fp_func1, 1)
+CODEGEN_PAIR(shared_ptr_pointer_volatile,   baz,                hsp_fp_func1, 1, 2)
+CODEGEN_PAIR(shared_ptr_pointer_const,      const baz,          hsp_fp_func1, 1, 2, 3)
+CODEGEN_PAIR(shared_ptr_pointer_cv,         const baz,          hsp_fp_func1, 1, 2, 3, 4)
+CODEGEN_PAIR(pointer_shared_ptr_plain,      baz,                hp_fsp_func1, 1)
+CODEGEN_PAIR(pointer_shared_ptr_volatile,   baz,                hp_fsp_func1, 1, 2)
+CODEGEN_PAIR(pointer_shared_ptr_const,      const baz,          hp_fsp_func1, 1, 2, 3)
+CODEGEN_PAIR(pointer_shared_ptr_cv,         const baz,          hp_fsp_func1, 1, 2, 3, 4)
@@ -0,0 +1,40 @@
+/**
+ * C++20 module interface unit exporting the templates of forward_to_member_core.hpp, along with the
+ * pointer_like_traits of the standard pointer-like types, as the forward_to_member module. The
+ * macros are not exported, as no named module can export a macro, so translation units importing
+ * the module include forward_to_member_macros.hpp after the import:
+ *
+ *     #include <type_traits>
+ *     #include <utility>
+ *     import forward_to_member;
+ *     #include "forward_to_member_macros.hpp"
+ *
+ * The macros use <type_traits> and <utility>, which forward_to_member_macros.hpp includes, but
+ * some compilers reject a standard header included after an import, hence including them first.
+ * A translation unit should either import the module or include forward_to_member.hpp (or a
+ * header including it, such as forward_to_member_async.hpp), not both: some compilers attach the
+ * exported templates to the module despite the extern "C++" and reject the second declaration.
+ * The module is built once per set of compiler options, e.g. with g++:
+ *
+ *     g++ -std=c++20 -fmodules-ts -c -x c++ forward_to_member.cppm
+ */
+
+module;
+
+/**
+ * The standard headers are included in the global module fragment, so the includes of the headers
+ * below find them already included.
+ */
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+export module forward_to_member;
+
+export extern "C++"
+{
+#include "forward_to_member_core.hpp"
+#include "forward_to_member_functional.hpp"
+#include "forward_to_member_memory.hpp"
+}
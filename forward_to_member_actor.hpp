@@ -0,0 +1,605 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_ACTOR and FORWARD_TO_MEMBER_ACTOR_POST macros, variants
+ * of FORWARD_TO_MEMBER_AS for a member that must only be touched by the thread owning it, such as
+ * an I/O context or an allocator. The member is held in a forward_to_member::actor, which owns it
+ * along with that thread, and the exposed functions do not call the method themselves but send the
+ * call to the owner thread:
+ *
+ *     class server
+ *     {
+ *     private:
+ *         forward_to_member::actor<io_context> io;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_ACTOR(io, open, open);
+ *         FORWARD_TO_MEMBER_ACTOR_POST(io, close, close);
+ *     };
+ *
+ *     forward_to_member::actor_future<int> fd = s.open(path);  // Waited for with fd.get().
+ *     s.close(fd.get());                                       // Returns at once.
+ *
+ * Each call is stored in a preallocated slot of a bounded ring buffer read by the owner thread,
+ * which callers claim without locking, so sending a call never allocates. The result of a call is
+ * kept in its slot until the caller reads it from the actor_future, which doesn't allocate either.
+ * The arguments are decay-copied into the slot like std::async does, lvalues are copied and rvalues
+ * moved, and passed to the method as rvalues.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_ACTOR_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_ACTOR_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include "forward_to_member.hpp"
+#include "forward_to_member_result.hpp"
+#include "forward_to_member_spin.hpp"
+
+namespace detail
+{
+
+/**
+ * One preallocated slot of the ring of an actor. sequence follows the position of the slot in the
+ * ring as in Dmitry Vyukov's bounded queue: it is the position a caller may claim the slot at, one
+ * more once the call is stored, and the position of the next lap once the slot is free again.
+ * A call whose result is awaited keeps its slot after it has run, with done set, until the caller
+ * has read the result. The slots are allocated with the default alignment, so neighbouring slots
+ * may share a cache line.
+ */
+struct actor_slot
+{
+    static constexpr std::size_t capacity = 96;
+
+    std::atomic<std::size_t> sequence;
+    std::atomic<bool> done;
+    bool awaited;
+    void (*invoke)(void* storage, void* object);
+    void (*destroy)(void* storage) noexcept;
+    typename std::aligned_storage<capacity, alignof(std::max_align_t)>::type storage;
+};
+
+/**
+ * An awaited call as stored in a slot: the callable and the result it gives once run on the
+ * object.
+ */
+template<typename F, typename R>
+struct actor_call
+{
+    F f;
+    call_result<R> result;
+
+    explicit actor_call(F&& f) noexcept : f(std::move(f)) { }
+};
+
+template<typename T, typename F>
+void actor_invoke_post(void* storage, void* object)
+{
+    (*static_cast<F*>(storage))(*static_cast<T*>(object));
+}
+
+template<typename T, typename F, typename R>
+void actor_invoke_call(void* storage, void* object)
+{
+    actor_call<F, R>& call = *static_cast<actor_call<F, R>*>(storage);
+    T& target = *static_cast<T*>(object);
+    call.result.run([&]() -> R { return call.f(target); });
+}
+
+template<typename S>
+void actor_destroy(void* storage) noexcept
+{
+    static_cast<S*>(storage)->~S();
+}
+
+} /* End namespace detail. */
+
+namespace forward_to_member
+{
+
+/**
+ * The result of a call sent to an actor, which is kept in the slot of the call until it is read
+ * by get or the future is destroyed, either of which waits for the call to have run. Move-only,
+ * like std::future, but waiting spins and yields rather than blocking, which suits short calls.
+ * The future must not outlive the actor.
+ */
+template<typename R>
+class actor_future
+{
+public:
+    actor_future() noexcept : slot(nullptr), result(nullptr), next(0) { }
+
+    actor_future(detail::actor_slot* slot, detail::call_result<R>* result, std::size_t next)
+        noexcept : slot(slot), result(result), next(next) { }
+
+    actor_future(actor_future&& other) noexcept
+        : slot(other.slot), result(other.result), next(other.next)
+    {
+        other.slot = nullptr;
+    }
+
+    actor_future& operator=(actor_future&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            slot = other.slot;
+            result = other.result;
+            next = other.next;
+            other.slot = nullptr;
+        }
+        return *this;
+    }
+
+    ~actor_future()
+    {
+        release();
+    }
+
+    bool valid() const noexcept
+    {
+        return slot != nullptr;
+    }
+
+    /**
+     * True once the call has run, so that get will not wait.
+     */
+    bool ready() const noexcept
+    {
+        return slot->done.load(std::memory_order_acquire);
+    }
+
+    void wait() const noexcept
+    {
+        for (unsigned spins = 0; !ready(); )
+        {
+            detail::spin_wait(spins);
+        }
+    }
+
+    /**
+     * Waits for the call and returns its result or throws its exception. The future is no longer
+     * valid afterwards.
+     */
+    R get()
+    {
+        wait();
+        struct guard
+        {
+            actor_future* future;
+            ~guard() { future->release(); }
+        } releasing{this};
+        return result->take();
+    }
+
+private:
+    /**
+     * Hands the slot back to the ring once the call has run.
+     */
+    void release() noexcept
+    {
+        if (slot)
+        {
+            wait();
+            slot->destroy(&slot->storage);
+            slot->sequence.store(next, std::memory_order_release);
+            slot = nullptr;
+        }
+    }
+
+    detail::actor_slot* slot;
+    detail::call_result<R>* result;
+    std::size_t next;
+};
+
+/**
+ * Holds an object of type T along with the thread owning it, which runs the calls sent to the
+ * actor one at a time in the order they were claimed. Calls are sent with post, which doesn't wait
+ * for them, or call, which returns an actor_future of their result, by any number of threads at
+ * once, or by a single thread at a time if SingleProducer is true, which saves the atomic
+ * read-modify-write claiming a slot. When all the Slots slots of the ring are taken, by calls that
+ * haven't run or by results that haven't been read, senders wait for one to be freed, so the owner
+ * thread must not send calls to its own actor and a thread keeping Slots futures must read one
+ * before sending another call.
+ *
+ * The object is constructed from the arguments of the constructor before the owner thread starts
+ * and destroyed after it has stopped. The owner thread waits for calls spinning for a while, then
+ * sleeping. The destructor runs the calls already sent before joining the owner thread.
+ */
+template<typename T, std::size_t Slots = 1024, bool SingleProducer = false>
+class actor
+{
+    static_assert(Slots >= 2 && (Slots & (Slots - 1)) == 0,
+                  "The number of slots of an actor must be a power of two.");
+
+public:
+    using value_type = T;
+
+    template<typename... Args>
+    explicit actor(Args&&... args)
+        : object(std::forward<Args>(args)...), slots(new detail::actor_slot[Slots]), tail(0),
+          sleeping(false), stopping(false)
+    {
+        for (std::size_t i = 0; i < Slots; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        owner = std::thread([this]() { run(); });
+    }
+
+    actor(const actor&) = delete;
+    actor& operator=(const actor&) = delete;
+
+    ~actor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_one();
+        owner.join();
+    }
+
+    /**
+     * Sends f, callable with a T&, to be called on the owner thread without waiting for it. An
+     * exception thrown by the call terminates the program, as one escaping a thread does.
+     */
+    template<typename F>
+    void post(F&& f) const
+    {
+        using D = typename std::decay<F>::type;
+        D stored(std::forward<F>(f));
+        emplace<D>(std::move(stored), &detail::actor_invoke_post<T, D>, false);
+    }
+
+    /**
+     * Sends f, callable with a T&, to be called on the owner thread and returns the future of its
+     * result.
+     */
+    template<typename F, typename D = typename std::decay<F>::type>
+    auto call(F&& f) const -> actor_future<decltype(std::declval<D&>()(std::declval<T&>()))>
+    {
+        using R = decltype(std::declval<D&>()(std::declval<T&>()));
+        using S = detail::actor_call<D, R>;
+        D stored(std::forward<F>(f));
+        const std::size_t position = emplace<S>(std::move(stored),
+                                                &detail::actor_invoke_call<T, D, R>, true);
+        detail::actor_slot& slot = slots[position & (Slots - 1)];
+        S* call = static_cast<S*>(static_cast<void*>(&slot.storage));
+        return actor_future<R>(&slot, &call->result, position + Slots);
+    }
+
+private:
+    /**
+     * Claims a slot, stores a call of type S constructed from stored in it and publishes it to the
+     * owner thread. Returns the position of the slot.
+     */
+    template<typename S, typename D>
+    std::size_t emplace(D&& stored, void (*invoke)(void*, void*), bool awaited) const
+    {
+        static_assert(sizeof(S) <= detail::actor_slot::capacity &&
+                      alignof(S) <= alignof(std::max_align_t),
+                      "The arguments and result of a call sent to an actor must fit in a slot.");
+        static_assert(std::is_nothrow_move_constructible<D>::value,
+                      "The arguments of a call sent to an actor must be nothrow movable.");
+        const std::size_t position = claim(std::integral_constant<bool, SingleProducer>());
+        detail::actor_slot& slot = slots[position & (Slots - 1)];
+        ::new (&slot.storage) S(std::move(stored));
+        slot.invoke = invoke;
+        slot.destroy = &detail::actor_destroy<S>;
+        slot.awaited = awaited;
+        slot.done.store(false, std::memory_order_relaxed);
+        slot.sequence.store(position + 1, std::memory_order_release);
+        wake();
+        return position;
+    }
+
+    /**
+     * Returns the position of a slot claimed for any number of concurrent senders, waiting for one
+     * to be free if the ring is full.
+     */
+    std::size_t claim(std::false_type) const
+    {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        for (unsigned spins = 0;;)
+        {
+            const std::size_t sequence =
+                slots[position & (Slots - 1)].sequence.load(std::memory_order_acquire);
+            const std::intptr_t lap = static_cast<std::intptr_t>(sequence - position);
+            if (lap == 0)
+            {
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    return position;
+                }
+            }
+            else
+            {
+                if (lap < 0)
+                {
+                    detail::spin_wait(spins);
+                }
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Same for a single sender at a time, which owns the tail.
+     */
+    std::size_t claim(std::true_type) const
+    {
+        const std::size_t position = tail.load(std::memory_order_relaxed);
+        const detail::actor_slot& slot = slots[position & (Slots - 1)];
+        for (unsigned spins = 0; slot.sequence.load(std::memory_order_acquire) != position; )
+        {
+            detail::spin_wait(spins);
+        }
+        tail.store(position + 1, std::memory_order_relaxed);
+        return position;
+    }
+
+    /**
+     * Wakes the owner thread up if it went to sleep. The fence orders the publication of the slot
+     * before the check of sleeping, and pairs with the one in idle, so that either the owner thread
+     * sees the slot or the sender sees it sleeping.
+     */
+    void wake() const
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.notify_one();
+        }
+    }
+
+    /**
+     * Waits for slot to be published at position, spinning for a while, then sleeping until a
+     * sender wakes the owner thread up. Returns false if the actor is stopping instead.
+     */
+    bool idle(const detail::actor_slot& slot, std::size_t position)
+    {
+        for (unsigned spins = 0, polls = 0; polls < 1024; ++polls, detail::spin_wait(spins))
+        {
+            if (slot.sequence.load(std::memory_order_acquire) == position)
+            {
+                return true;
+            }
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (slot.sequence.load(std::memory_order_acquire) != position && !stopping)
+        {
+            ready.wait(lock);
+        }
+        sleeping.store(false, std::memory_order_relaxed);
+        return slot.sequence.load(std::memory_order_acquire) == position;
+    }
+
+    /**
+     * The loop of the owner thread, running the calls in order until the actor is stopping and
+     * no call is left.
+     */
+    void run()
+    {
+        for (std::size_t head = 0;; ++head)
+        {
+            detail::actor_slot& slot = slots[head & (Slots - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1 && !idle(slot, head + 1))
+            {
+                return;
+            }
+            slot.invoke(&slot.storage, &object);
+            if (slot.awaited)
+            {
+                slot.done.store(true, std::memory_order_release);
+            }
+            else
+            {
+                slot.destroy(&slot.storage);
+                slot.sequence.store(head + Slots, std::memory_order_release);
+            }
+        }
+    }
+
+    T object;
+    std::unique_ptr<detail::actor_slot[]> slots;
+    mutable std::atomic<std::size_t> tail;
+    mutable std::atomic<bool> sleeping;
+    mutable std::mutex mutex;
+    mutable std::condition_variable ready;
+    bool stopping;
+    std::thread owner;
+};
+
+/**
+ * An actor to which a single thread at a time sends calls.
+ */
+template<typename T, std::size_t Slots = 1024>
+using single_producer_actor = actor<T, Slots, true>;
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * The callable sent to the actor by the exposed functions. Call::call(object, args...) calls the
+ * method on the object seen with the cv qualification Object of the exposed function, and the
+ * arguments are stored by value.
+ */
+template<typename Call, typename Object, typename... Args>
+struct actor_task
+{
+    std::tuple<Args...> args;
+
+    template<typename... TArgs>
+    explicit actor_task(int, TArgs&&... args) : args(std::forward<TArgs>(args)...) { }
+
+    auto operator()(Object& object)
+        -> decltype(Call::call(object, std::declval<Args>()...))
+    {
+        return invoke(object, typename make_forward_member_indices<sizeof...(Args)>::type());
+    }
+
+    template<std::size_t... I>
+    auto invoke(Object& object, forward_member_indices<I...>)
+        -> decltype(Call::call(object, std::declval<Args>()...))
+    {
+        return Call::call(object, std::move(std::get<I>(args))...);
+    }
+};
+
+/**
+ * The actor type A of a member, with its cv qualification, and the object it holds as seen through
+ * it. The actor is used without its volatile qualification, actors being synchronized on their own.
+ */
+template<typename A>
+using actor_object = typename forward_member_copy_cv<A, typename A::value_type>::type;
+
+template<typename Call, typename A, typename... TArgs>
+using actor_task_type = actor_task<Call, actor_object<A>, typename std::decay<TArgs>::type...>;
+
+template<typename A>
+const typename std::remove_cv<A>::type& actor_unqualified(A& actor) noexcept
+{
+    return const_cast<const typename std::remove_cv<A>::type&>(actor);
+}
+
+/**
+ * The result of the method for the decayed arguments, which are what it is called with.
+ */
+template<typename Call, typename A, typename... TArgs>
+using actor_result_type = decltype(Call::call(std::declval<actor_object<A>&>(),
+                                              std::declval<typename std::decay<TArgs>::type>()...));
+
+/**
+ * Sends a call of the method to actor and returns the future of its result.
+ */
+template<typename Call, typename A, typename... TArgs>
+auto actor_call_submit(A& actor, TArgs&&... args)
+    -> forward_to_member::actor_future<actor_result_type<Call, A, TArgs...>>
+{
+    return actor_unqualified(actor).call(
+        actor_task_type<Call, A, TArgs...>(0, std::forward<TArgs>(args)...));
+}
+
+/**
+ * Sends a call of the method to actor without waiting for it.
+ */
+template<typename Call, typename A, typename... TArgs>
+auto actor_post_submit(A& actor, TArgs&&... args)
+    -> decltype(void(std::declval<actor_result_type<Call, A, TArgs...>>()))
+{
+    actor_unqualified(actor).post(
+        actor_task_type<Call, A, TArgs...>(0, std::forward<TArgs>(args)...));
+}
+
+} /* End namespace detail. */
+
+/**
+ * Declares one candidate of FORWARD_TO_MEMBER_DETAIL_ACTOR. The actor is made const if the overload
+ * selected is, as FORWARD_TO_MEMBER_AS does, so that it is also called through a pointer member.
+ *
+ * @param cv The cv qualification of the candidate.
+ * @param condition The condition on the function traits and the member for the candidate.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, cv, condition)                   \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args) cv                                                                     \
+        -> typename std::enable_if<                                                                \
+               condition,                                                                          \
+               decltype(submit<actor_call_##m##_##f##_##n>(                                        \
+                   detail::forward_member_target<                                                  \
+                       actor_traits_##m##_##f##_##n<TArgs...>::has_const, TArgs...>(m),            \
+                   std::forward<TArgs>(args)...))>::type                                           \
+    {                                                                                              \
+        return submit<actor_call_##m##_##f##_##n>(                                                 \
+            detail::forward_member_target<                                                         \
+                actor_traits_##m##_##f##_##n<TArgs...>::has_const, TArgs...>(m),                   \
+            std::forward<TArgs>(args)...);                                                         \
+    }
+
+/**
+ * Generates the exposed functions of FORWARD_TO_MEMBER_ACTOR and FORWARD_TO_MEMBER_ACTOR_POST,
+ * which send calls to the actor with submit.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_ACTOR(m, f, n, submit)                                            \
+    using member_type_##m##_##f##_##n =                                                            \
+        detail::forward_member_underlying_type<decltype(m)>::type::value_type;                     \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    /**                                                                                            \
+     * The traits of the overload selected by the decayed arguments.                               \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    using actor_traits_##m##_##f##_##n = function_traits_##m##_##f##_##n<                          \
+        member_type_##m##_##f##_##n&, typename std::decay<TArgs>::type...>;                        \
+                                                                                                   \
+    /**                                                                                            \
+     * Calls f on the object of the actor on its owner thread.                                     \
+     */                                                                                            \
+    struct actor_call_##m##_##f##_##n                                                              \
+    {                                                                                              \
+        template <typename Object, typename... TArgs>                                              \
+        static auto call(Object& object, TArgs&&... args)                                          \
+            -> decltype(object.f(std::forward<TArgs>(args)...))                                    \
+        {                                                                                          \
+            return object.f(std::forward<TArgs>(args)...);                                         \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, ,                                    \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_plain)                                          \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, volatile,                            \
+        detail::is_volatile_accessible<decltype(m)>::value &&                                      \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_volatile)                                       \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, ,                                    \
+        !detail::is_volatile_accessible<decltype(m)>::value &&                                     \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_volatile)                                       \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, const,                               \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_const)                                          \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, const volatile,                      \
+        detail::is_volatile_accessible<decltype(m)>::value &&                                      \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_cv)                                             \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR_CANDIDATE(m, f, n, submit, const,                               \
+        !detail::is_volatile_accessible<decltype(m)>::value &&                                     \
+        actor_traits_##m##_##f##_##n<TArgs...>::is_cv)
+
+/**
+ * Generates code which exposes a function in some class that sends a call of a method (potentially
+ * having several overloads) on the object held by one of the class's members, a
+ * forward_to_member::actor, to the actor's owner thread, returning a
+ * forward_to_member::actor_future of its result. The member can also point to the actor, through
+ * anything FORWARD_TO_MEMBER_AS accepts, and the exposed functions have the same cv qualifications
+ * as FORWARD_TO_MEMBER_AS would give them for a member of the type the actor holds. The overload is
+ * classified for the decayed arguments since those are what the method is called with.
+ *
+ * @param m The name of the member variable holding the actor.
+ * @param f The name of the function to invoke on the object of the actor.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_ACTOR(m, f, n)                                                           \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR(m, f, n, detail::actor_call_submit)
+
+/**
+ * Same as FORWARD_TO_MEMBER_ACTOR, but the exposed function returns as soon as the call is sent,
+ * without a way to wait for it or for its result.
+ *
+ * @param m The name of the member variable holding the actor.
+ * @param f The name of the function to invoke on the object of the actor.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_ACTOR_POST(m, f, n)                                                      \
+    FORWARD_TO_MEMBER_DETAIL_ACTOR(m, f, n, detail::actor_post_submit)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_ACTOR_HPP__ */
@@ -0,0 +1,204 @@
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "forward_to_member_actor.hpp"
+#include "test_allocation_counter.hpp"
+
+/**
+ * Simple structure for testing with overloads in several cv classes, overloads differing only by
+ * their constness, a function returning nothing, a function returning a reference, a function
+ * taking a move-only argument and a function throwing. It is not thread-safe and checks that it is
+ * only ever used by one thread.
+ */
+struct ledger
+{
+    int balance;
+    std::thread::id owner;
+    ledger() : balance(0) { }
+    void check()
+    {
+        if (owner == std::thread::id())
+        {
+            owner = std::this_thread::get_id();
+        }
+        assert(owner == std::this_thread::get_id());
+    }
+    int deposit(int amount) { check(); return balance += amount; }
+    int deposit(int amount, int times) { check(); return balance += amount * times; }
+    int read() const { return balance; }
+    int read(int scale) const volatile { return balance * scale; }
+    int kind() { check(); return 1; }
+    int kind() const { return 2; }
+    void clear() { check(); balance = 0; }
+    int& account() { check(); return balance; }
+    std::size_t consume(std::unique_ptr<std::string> s) { check(); return s->size(); }
+    std::string name(std::string prefix) const { return prefix + "ledger"; }
+    int fail() const { throw std::runtime_error("failed"); }
+};
+
+/**
+ * Forwards to a ledger owned by an actor held by value, whose calls are sent by any thread, to one
+ * owned by an actor held by a shared pointer, whose calls are sent by a single thread, and to the
+ * first through a pointer.
+ */
+struct bank
+{
+    forward_to_member::actor<ledger, 64> owned;
+    FORWARD_TO_MEMBER_ACTOR(owned, deposit, deposit);
+    FORWARD_TO_MEMBER_ACTOR_POST(owned, deposit, deposit_post);
+    FORWARD_TO_MEMBER_ACTOR(owned, read, read);
+    FORWARD_TO_MEMBER_ACTOR(owned, clear, clear);
+    FORWARD_TO_MEMBER_ACTOR_POST(owned, clear, clear_post);
+    FORWARD_TO_MEMBER_ACTOR(owned, account, account);
+    FORWARD_TO_MEMBER_ACTOR(owned, consume, consume);
+    FORWARD_TO_MEMBER_ACTOR(owned, name, name);
+    FORWARD_TO_MEMBER_ACTOR(owned, fail, fail);
+
+    std::shared_ptr<forward_to_member::single_producer_actor<ledger, 4>> shared;
+    FORWARD_TO_MEMBER_ACTOR(shared, deposit, shared_deposit);
+    FORWARD_TO_MEMBER_ACTOR_POST(shared, deposit, shared_deposit_post);
+    FORWARD_TO_MEMBER_ACTOR(shared, read, shared_read);
+
+    forward_to_member::actor<ledger, 64>* pointer;
+    FORWARD_TO_MEMBER_ACTOR(pointer, kind, pointer_kind);
+
+    bank()
+        : shared(std::make_shared<forward_to_member::single_producer_actor<ledger, 4>>()),
+          pointer(&owned)
+    {
+    }
+};
+
+int main()
+{
+    bank b;
+    const bank& bc = b;
+    volatile bank& bv = b;
+
+    // Results come back through the futures and every call runs exactly once, in order.
+    std::vector<forward_to_member::actor_future<int>> futures;
+    for (int i = 1; i <= 32; ++i)
+    {
+        futures.push_back(b.deposit(1));
+    }
+    for (int i = 1; i <= 32; ++i)
+    {
+        assert(i == futures[i - 1].get());
+        assert(!futures[i - 1].valid());
+    }
+    assert(32 == bc.read().get());
+    assert(42 == b.deposit(5, 2).get());
+    assert(84 == bv.read(2).get());
+    b.clear().get();
+    assert(0 == bc.read().get());
+    b.deposit_post(3);
+    b.clear_post();
+    assert(0 == bc.read().get());
+
+    // The exposed functions return a future of the result, or nothing when posting.
+    static_assert(std::is_same<decltype(bc.read()), forward_to_member::actor_future<int>>::value,
+                  "The exposed function should return a future of the result.");
+    static_assert(std::is_same<decltype(b.deposit_post(1)), void>::value,
+                  "The posting function should return nothing.");
+
+    // Fire-and-forget calls run in order with the others, and more of them than there are slots
+    // wait for slots to be freed.
+    for (int i = 0; i < 1000; ++i)
+    {
+        b.deposit_post(1);
+    }
+    assert(1000 == bc.read().get());
+
+    // References to the object are returned as is.
+    int& account = b.account().get();
+    assert(&account == &b.account().get() && 1000 == account);
+
+    // Lvalue arguments are copied, rvalues moved, and move-only arguments are supported.
+    std::string prefix("the ");
+    assert("the ledger" == bc.name(prefix).get() && "the " == prefix);
+    std::unique_ptr<std::string> text(new std::string("hello"));
+    assert(5 == b.consume(std::move(text)).get());
+
+    // Exceptions are delivered through the future.
+    bool thrown = false;
+    try
+    {
+        bc.fail().get();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // A future destroyed unread waits for its call and frees its slot, and one moved from is no
+    // longer valid.
+    for (int i = 0; i < 200; ++i)
+    {
+        b.deposit(-1);
+    }
+    forward_to_member::actor_future<int> moved = b.deposit(0);
+    forward_to_member::actor_future<int> target(std::move(moved));
+    assert(!moved.valid() && target.valid());
+    assert(800 == target.get());
+
+    // Calls are sent by many threads at once to an actor whose ring is much smaller than the
+    // number of calls in flight.
+    std::vector<std::thread> senders;
+    for (int t = 0; t < 8; ++t)
+    {
+        senders.emplace_back([&b]()
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                b.deposit_post(1);
+                if (i % 100 == 0)
+                {
+                    b.deposit(0).get();
+                }
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    assert(8800 == bc.read().get());
+
+    // The actor can be pointed to and be fed by a single thread.
+    for (int i = 0; i < 100; ++i)
+    {
+        b.shared_deposit_post(2);
+    }
+    assert(202 == b.shared_deposit(2).get());
+    assert(202 == bc.shared_read().get());
+
+    // The const overload is called through a pointer, as FORWARD_TO_MEMBER_AS would call it.
+    assert(2 == b.pointer_kind().get());
+    assert(2 == bc.pointer_kind().get());
+
+    // Sending calls allocates nothing.
+    const long before = allocations;
+    for (int i = 0; i < 100; ++i)
+    {
+        b.deposit_post(1);
+        b.deposit(1, 2).get();
+        b.shared_deposit(1).get();
+    }
+    assert(before == allocations);
+
+    // Calls sent before the actor is destroyed still run.
+    std::shared_ptr<std::atomic<int>> runs = std::make_shared<std::atomic<int>>(0);
+    {
+        forward_to_member::actor<ledger, 8> drained;
+        for (int i = 0; i < 100; ++i)
+        {
+            drained.post([runs](ledger&) { ++*runs; });
+        }
+    }
+    assert(100 == *runs);
+}
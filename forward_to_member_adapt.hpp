@@ -0,0 +1,370 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_ADAPT macro, which exposes a function converting its
+ * arguments with a list of adapters before calling a method on a member, for members whose methods
+ * take other types than the ones the class exposes:
+ *
+ *     struct catalog
+ *     {
+ *         int find(const std::string& key) const;
+ *         void store(std::span<const char> bytes);
+ *     };
+ *
+ *     class facade
+ *     {
+ *     private:
+ *         catalog c;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_ADAPT(c, find, find, forward_to_member::view_as_string);
+ *         FORWARD_TO_MEMBER_ADAPT(c, store, store, forward_to_member::pointer_length_as_span);
+ *     };
+ *
+ *     facade f;
+ *     f.find(std::string_view("key"));  // Makes the std::string find requires.
+ *     f.store(buffer, size);             // Passes a std::span of the buffer, copying nothing.
+ *
+ * An adapter is a class with a static constexpr std::size_t arity, the number of consecutive
+ * arguments it converts, and a static function adapt taking them and returning what to pass in
+ * their place, constrained so that it only accepts the arguments it applies to. Requires C++17.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_ADAPT_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_ADAPT_HPP__
+
+#if __cplusplus < 201703L
+#error "forward_to_member_adapt.hpp requires C++17"
+#endif
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if __has_include(<span>)
+#include <span>
+#endif
+#if defined(__cpp_lib_span)
+#include <vector>
+#endif
+#include "forward_to_member.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Adapter converting a std::basic_string_view to a std::basic_string holding a copy of it, for a
+ * function taking a const std::basic_string&. The copy allocates unless it fits in the small
+ * string buffer.
+ */
+struct view_as_string
+{
+    static constexpr std::size_t arity = 1;
+
+    template<typename C, typename Traits>
+    static std::basic_string<C, Traits> adapt(std::basic_string_view<C, Traits> view)
+    {
+        return std::basic_string<C, Traits>(view);
+    }
+};
+
+#if defined(__cpp_lib_span)
+/**
+ * Adapter converting a pointer and a number of elements to a std::span of them, for a function
+ * taking a std::span. Requires C++20.
+ */
+struct pointer_length_as_span
+{
+    static constexpr std::size_t arity = 2;
+
+    template<typename T, typename Size, typename = std::enable_if_t<std::is_integral_v<Size>>>
+    static constexpr std::span<T> adapt(T* data, Size size) noexcept
+    {
+        return std::span<T>(data, static_cast<std::size_t>(size));
+    }
+};
+
+/**
+ * Adapter converting a std::span to a std::vector holding a copy of its elements, for a function
+ * taking a const std::vector&. The copy allocates unless the span is empty. Requires C++20.
+ */
+struct span_as_vector
+{
+    static constexpr std::size_t arity = 1;
+
+    template<typename T, std::size_t Extent>
+    static std::vector<std::remove_cv_t<T>> adapt(std::span<T, Extent> span)
+    {
+        return std::vector<std::remove_cv_t<T>>(span.begin(), span.end());
+    }
+};
+#endif
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * List of types, holding the adapters of an exposed function and the steps of a plan.
+ */
+template<typename... T>
+struct forward_member_adapt_list { };
+
+/**
+ * The plan when no adaptation of the arguments makes the call valid.
+ */
+struct forward_member_adapt_none { };
+
+/**
+ * Adapter passing an argument unchanged, which is tried before the adapters of the function.
+ */
+struct forward_member_adapt_pass
+{
+    static constexpr std::size_t arity = 1;
+
+    template<typename T>
+    static constexpr T&& adapt(T&& arg) noexcept
+    {
+        return static_cast<T&&>(arg);
+    }
+};
+
+/**
+ * Step of a plan passing the Adapter::arity arguments of Args, the std::tuple of references to the
+ * arguments of the exposed function, from the I-th through Adapter. type is the type of what the
+ * step passes, and there is none if Adapter doesn't accept these arguments.
+ */
+template<typename Adapter, std::size_t I, typename Args,
+         typename Indices = std::make_index_sequence<Adapter::arity>, typename = void>
+struct forward_member_adapt_step { };
+
+template<typename Adapter, std::size_t I, typename Args, std::size_t... J>
+struct forward_member_adapt_step<
+    Adapter, I, Args, std::index_sequence<J...>,
+    std::void_t<decltype(Adapter::adapt(std::get<I + J>(std::declval<Args>())...))>>
+{
+    using type = decltype(Adapter::adapt(std::get<I + J>(std::declval<Args>())...));
+
+    static constexpr type get(Args& args)
+    {
+        return Adapter::adapt(std::get<I + J>(std::move(args))...);
+    }
+};
+
+template<typename Step, typename = void>
+constexpr bool forward_member_adapt_accepts = false;
+
+template<typename Step>
+constexpr bool forward_member_adapt_accepts<Step, std::void_t<typename Step::type>> = true;
+
+/**
+ * Tells if Call can be made with the given constness on a Member with arguments of types T.
+ */
+template<typename Void, typename Call, bool Const, typename Member, typename... T>
+struct forward_member_adapt_callable : public std::false_type { };
+
+template<typename Call, bool Const, typename Member, typename... T>
+struct forward_member_adapt_callable<
+    std::void_t<decltype(Call::template call<Const>(std::declval<Member&>(),
+                                                    std::declval<T>()...))>,
+    Call, Const, Member, T...> : public std::true_type { };
+
+template<typename Call, bool Const, typename Member>
+struct forward_member_adapt_check
+{
+    template<typename... T>
+    static constexpr bool valid =
+        forward_member_adapt_callable<void, Call, Const, Member, T...>::value;
+};
+
+/**
+ * Finds how to pass the arguments of Args from the I-th on, after Steps, so that Check::valid holds
+ * for the types of all the steps. The I-th argument is passed unchanged if a plan for the remaining
+ * arguments then exists, or else through the first of Adapters for which one does, so an argument
+ * is only converted if the call can't be made without it. Returns the steps of the plan as a
+ * forward_member_adapt_list, or forward_member_adapt_none if there is no plan. The search happens
+ * at compile time only.
+ */
+template<typename Check, typename Args, std::size_t I, typename... Adapters, typename... Steps>
+constexpr auto forward_member_adapt_plan(forward_member_adapt_list<Adapters...> adapters,
+                                         forward_member_adapt_list<Steps...> steps);
+
+/**
+ * Finds the plan whose next step passes the arguments of Args from the I-th through Option.
+ */
+template<typename Check, typename Args, std::size_t I, typename Option, typename Adapters,
+         typename... Steps>
+constexpr auto forward_member_adapt_with(Adapters adapters, forward_member_adapt_list<Steps...>)
+{
+    using step = forward_member_adapt_step<Option, I, Args>;
+    if constexpr (I + Option::arity > std::tuple_size_v<Args>)
+    {
+        return forward_member_adapt_none();
+    }
+    else if constexpr (!forward_member_adapt_accepts<step>)
+    {
+        return forward_member_adapt_none();
+    }
+    else
+    {
+        return forward_member_adapt_plan<Check, Args, I + Option::arity>(
+            adapters, forward_member_adapt_list<Steps..., step>());
+    }
+}
+
+/**
+ * Finds the plan whose next step passes the arguments of Args from the I-th through the first of
+ * the options for which one exists.
+ */
+template<typename Check, typename Args, std::size_t I, typename Adapters, typename Steps>
+constexpr auto forward_member_adapt_try(Adapters, Steps, forward_member_adapt_list<>)
+{
+    return forward_member_adapt_none();
+}
+
+template<typename Check, typename Args, std::size_t I, typename Adapters, typename Steps,
+         typename Option, typename... Options>
+constexpr auto forward_member_adapt_try(Adapters adapters, Steps steps,
+                                        forward_member_adapt_list<Option, Options...>)
+{
+    using plan = decltype(forward_member_adapt_with<Check, Args, I, Option>(adapters, steps));
+    if constexpr (std::is_same_v<plan, forward_member_adapt_none>)
+    {
+        return forward_member_adapt_try<Check, Args, I>(adapters, steps,
+                                                        forward_member_adapt_list<Options...>());
+    }
+    else
+    {
+        return plan();
+    }
+}
+
+template<typename Check, typename Args, std::size_t I, typename... Adapters, typename... Steps>
+constexpr auto forward_member_adapt_plan(forward_member_adapt_list<Adapters...> adapters,
+                                         forward_member_adapt_list<Steps...> steps)
+{
+    if constexpr (I < std::tuple_size_v<Args>)
+    {
+        return forward_member_adapt_try<Check, Args, I>(
+            adapters, steps, forward_member_adapt_list<forward_member_adapt_pass, Adapters...>());
+    }
+    else if constexpr (Check::template valid<typename Steps::type...>)
+    {
+        return steps;
+    }
+    else
+    {
+        return forward_member_adapt_none();
+    }
+}
+
+/**
+ * The plan for calling Call with the given constness on a Member with the arguments TArgs of the
+ * exposed function, converted by Adapters.
+ */
+template<typename Call, bool Const, typename Member, typename Adapters, typename... TArgs>
+using forward_member_adapt_plan_t = decltype(
+    forward_member_adapt_plan<forward_member_adapt_check<Call, Const, Member>,
+                              std::tuple<TArgs&&...>, 0>(Adapters(),
+                                                         forward_member_adapt_list<>()));
+
+/**
+ * Gets the result type of the exposed function, if there is a plan for the call, which removes it
+ * from overload resolution otherwise.
+ */
+template<typename Call, bool Const, typename Member, typename Plan>
+struct forward_member_adapt_plan_result { };
+
+template<typename Call, bool Const, typename Member, typename... Steps>
+struct forward_member_adapt_plan_result<Call, Const, Member, forward_member_adapt_list<Steps...>>
+{
+    using type = decltype(Call::template call<Const>(std::declval<Member&>(),
+                                                     std::declval<typename Steps::type>()...));
+};
+
+template<typename Call, bool Const, typename Member, typename Adapters, typename... TArgs>
+struct forward_member_adapt_result
+    : public forward_member_adapt_plan_result<
+          Call, Const, Member,
+          forward_member_adapt_plan_t<Call, Const, Member, Adapters, TArgs...>> { };
+
+template<typename Call, bool Const, typename Member, typename Args, typename... Steps>
+constexpr decltype(auto) forward_member_adapt_apply(Member& member, Args& args,
+                                                    forward_member_adapt_list<Steps...>)
+{
+    return Call::template call<Const>(member, Steps::get(args)...);
+}
+
+/**
+ * Calls Call with the given constness on member with args, the references to the arguments of the
+ * exposed function, converted as planned. The converted arguments are temporaries that live until
+ * the call returns, and the others are passed by reference.
+ */
+template<typename Call, bool Const, typename Adapters, typename... TArgs, typename Member>
+constexpr decltype(auto) forward_member_adapt(Member& member, std::tuple<TArgs&&...> args)
+{
+    return forward_member_adapt_apply<Call, Const>(
+        member, args, forward_member_adapt_plan_t<Call, Const, Member, Adapters, TArgs...>());
+}
+
+} /* End namespace detail. */
+
+/**
+ * Generates code which exposes a function in some class that invokes a method (potentially having
+ * several overloads) on a member, converting the arguments with adapters when the call can't be
+ * made with them as they are. Each argument, from the first, is passed unchanged if the call can
+ * then be made, or else through the first adapter accepting it (and the arguments following it,
+ * for an adapter whose arity is more than one) with which the call can be made. The choice is made
+ * at compile time, and at run time arguments are passed by reference and converted ones as
+ * temporaries, so an argument passed unchanged, or converted to a view such as a std::span, copies
+ * and allocates nothing. The member can be a value, a reference, a pointer or a pointer-like type.
+ * The exposed function is const if the call can be made on the member made const, which selects a
+ * const overload. Volatile overloads are not exposed.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ * @param ... The adapters, tried in the order given.
+ */
+#define FORWARD_TO_MEMBER_ADAPT(m, f, n, ...)                                                      \
+    using adapters_##m##_##f##_##n = detail::forward_member_adapt_list<__VA_ARGS__>;               \
+                                                                                                   \
+    /**                                                                                            \
+     * Calls the function on the member, made const if Const is true.                              \
+     */                                                                                            \
+    struct adapt_call_##m##_##f##_##n                                                              \
+    {                                                                                              \
+        template <bool Const, typename T, typename... TArgs>                                       \
+        static constexpr auto call(T& member, TArgs&&... args)                                     \
+            -> decltype(detail::forward_member_target<Const, TArgs...>(member).f(                  \
+                   static_cast<TArgs&&>(args)...))                                                 \
+        {                                                                                          \
+            return detail::forward_member_target<Const, TArgs...>(member).f(                       \
+                static_cast<TArgs&&>(args)...);                                                    \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    constexpr auto n(TArgs&&... args) const                                                        \
+        -> typename detail::forward_member_adapt_result<                                           \
+               adapt_call_##m##_##f##_##n, true, std::remove_reference_t<decltype((m))>,           \
+               adapters_##m##_##f##_##n, TArgs...>::type                                           \
+    {                                                                                              \
+        return detail::forward_member_adapt<adapt_call_##m##_##f##_##n, true,                      \
+                                            adapters_##m##_##f##_##n, TArgs...>(                  \
+            m, std::forward_as_tuple(static_cast<TArgs&&>(args)...));                              \
+    }                                                                                              \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    constexpr auto n(TArgs&&... args)                                                              \
+        -> typename detail::forward_member_adapt_result<                                           \
+               adapt_call_##m##_##f##_##n, false, std::remove_reference_t<decltype((m))>,          \
+               adapters_##m##_##f##_##n, TArgs...>::type                                           \
+    {                                                                                              \
+        return detail::forward_member_adapt<adapt_call_##m##_##f##_##n, false,                     \
+                                            adapters_##m##_##f##_##n, TArgs...>(                  \
+            m, std::forward_as_tuple(static_cast<TArgs&&>(args)...));                              \
+    }
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_ADAPT_HPP__ */
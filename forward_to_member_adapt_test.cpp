@@ -0,0 +1,167 @@
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "forward_to_member_adapt.hpp"
+#include "test_allocation_counter.hpp"
+
+/**
+ * A key too long for the small string buffer, so that copying it to a std::string allocates.
+ */
+static const std::string_view long_key = "a key much too long to fit in the small string buffer";
+
+/**
+ * Member whose methods take owning types, with overloads taking views for some of them.
+ */
+struct catalog
+{
+    std::string last;
+    std::vector<int> values;
+
+    std::size_t find(const std::string& key) const { return key.size(); }
+    void store(const std::string& key) { last = key; }
+    int size(std::string_view key) const { return static_cast<int>(key.size()); }
+    int size(const std::string&) const { return -1; }
+    std::size_t concat(const std::string& a, std::string_view b) const
+    {
+        return a.size() + b.size();
+    }
+    void assign(const std::vector<int>& v) { values = v; }
+#if defined(__cpp_lib_span)
+    int sum(std::span<const int> s) const
+    {
+        int total = 0;
+        for (int i : s)
+        {
+            total += i;
+        }
+        return total;
+    }
+    int first(const int* data, std::size_t) const { return -data[0]; }
+    int first(std::span<const int> s) const { return s[0]; }
+#endif
+    long wait(long milliseconds) const { return milliseconds; }
+};
+
+/**
+ * User-defined adapter converting a std::chrono::duration to its count of milliseconds.
+ */
+struct duration_as_milliseconds
+{
+    static constexpr std::size_t arity = 1;
+
+    template<typename Rep, typename Period>
+    static long adapt(std::chrono::duration<Rep, Period> d)
+    {
+        return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(d).count());
+    }
+};
+
+/**
+ * Forwards to a catalog held by value, pointer and shared_ptr.
+ */
+struct facade
+{
+    catalog c;
+    catalog* p;
+    std::shared_ptr<catalog> s;
+
+    FORWARD_TO_MEMBER_ADAPT(c, find, find, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, store, store, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, size, size, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, concat, concat, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(c, wait, wait, duration_as_milliseconds);
+    FORWARD_TO_MEMBER_ADAPT(p, find, p_find, forward_to_member::view_as_string);
+    FORWARD_TO_MEMBER_ADAPT(s, store, s_store, forward_to_member::view_as_string);
+#if defined(__cpp_lib_span)
+    FORWARD_TO_MEMBER_ADAPT(c, sum, sum, forward_to_member::pointer_length_as_span);
+    FORWARD_TO_MEMBER_ADAPT(c, first, first, forward_to_member::pointer_length_as_span);
+    FORWARD_TO_MEMBER_ADAPT(c, assign, assign, forward_to_member::span_as_vector);
+    FORWARD_TO_MEMBER_ADAPT(p, sum, p_sum, forward_to_member::pointer_length_as_span);
+#endif
+};
+
+/**
+ * Tells if store can be called on a T with an Arg.
+ */
+template<typename T, typename Arg, typename = void>
+struct can_store : public std::false_type { };
+
+template<typename T, typename Arg>
+struct can_store<T, Arg, std::void_t<decltype(std::declval<T&>().store(std::declval<Arg>()))>>
+    : public std::true_type { };
+
+static_assert(can_store<facade, std::string_view>::value, "store is exposed");
+static_assert(!can_store<const facade, std::string_view>::value, "store is not const");
+static_assert(!can_store<facade, int>::value, "no adapter makes an int a std::string");
+
+int main()
+{
+    catalog pointed;
+    facade f{catalog(), &pointed, std::make_shared<catalog>()};
+    const facade& cf = f;
+    const std::string owned(long_key);
+
+    // Arguments the member takes as they are are passed by reference, without copying.
+    long before = allocations;
+    assert(long_key.size() == cf.find(owned));
+    assert(long_key.size() == cf.p_find(owned));
+    assert(static_cast<int>(long_key.size()) == cf.size(long_key));
+    assert(-1 == cf.size(owned));
+    assert(before == allocations);
+
+    // A view is converted to a std::string when the member takes nothing else, allocating once.
+    before = allocations;
+    assert(long_key.size() == cf.find(long_key));
+    assert(before + 1 == allocations);
+    before = allocations;
+    assert(long_key.size() == cf.p_find(long_key));
+    assert(before + 1 == allocations);
+
+    // Only the arguments that need it are converted.
+    before = allocations;
+    assert(2 * long_key.size() == cf.concat(long_key, long_key));
+    assert(before + 1 == allocations);
+
+    // Non-const methods are only exposed as non-const functions, through every kind of member.
+    f.store(long_key);
+    assert(long_key == f.c.last);
+    f.s_store(std::string_view("shared"));
+    assert("shared" == f.s->last);
+
+    // Adapters defined by the user are used like the provided ones.
+    assert(1500 == cf.wait(std::chrono::seconds(1) + std::chrono::milliseconds(500)));
+    assert(20 == cf.wait(20L));
+
+#if defined(__cpp_lib_span)
+    // A pointer and a length are passed as a std::span of the elements, copying nothing.
+    const int numbers[] = {1, 2, 3, 4};
+    std::vector<int> more = {5, 6};
+    before = allocations;
+    assert(6 == cf.sum(numbers, 3));
+    assert(11 == cf.sum(more.data(), more.size()));
+    assert(10 == cf.sum(std::span<const int>(numbers)));
+    assert(10 == cf.p_sum(numbers, 4));
+    assert(before == allocations);
+
+    // The overload taking the pointer and the length, when there is one, is called as it is.
+    assert(-1 == cf.first(numbers, 4));
+    assert(1 == cf.first(std::span<const int>(numbers)));
+
+    // A span is copied to a std::vector when the member takes nothing else.
+    before = allocations;
+    f.assign(std::span<const int>(numbers, 2));
+    assert(before + 2 == allocations);
+    assert((std::vector<int>{1, 2} == f.c.values));
+
+    // A std::vector is passed by reference, and assign reuses the capacity of values.
+    before = allocations;
+    f.assign(more);
+    assert(before == allocations);
+    assert(more == f.c.values);
+#endif
+}
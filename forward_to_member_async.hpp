@@ -0,0 +1,645 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_ASYNC macro, a variant of FORWARD_TO_MEMBER_AS whose
+ * exposed function does not call the method itself but submits the call to an executor and returns
+ * a forward_to_member::async_future of its result:
+ *
+ *     class store
+ *     {
+ *     private:
+ *         forward_to_member::thread_pool pool;
+ *         database db;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_ASYNC(db, load, load_async, pool);
+ *     };
+ *
+ *     forward_to_member::async_future<record> r = s.load_async(key);
+ *
+ * The arguments are decay-copied into the task like std::async does, lvalues are copied and
+ * rvalues moved, and passed to the method as rvalues. The task holds the arguments inline and the
+ * result is kept in a slot recycled once its future is destroyed, so a call allocates nothing as
+ * long as the executor does not allocate either; forward_to_member::thread_pool doesn't for tasks
+ * of up to forward_to_member::small_task::capacity bytes. The object must outlive the calls it
+ * submits.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_ASYNC_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_ASYNC_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "forward_to_member.hpp"
+#include "forward_to_member_result.hpp"
+#include "forward_to_member_spin.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Move-only type-erased void() callable that stores callables of up to capacity bytes inline and
+ * larger ones on the heap.
+ */
+class small_task
+{
+public:
+    static constexpr std::size_t capacity = 96;
+
+    small_task() noexcept : ops(nullptr) { }
+
+    template<typename F, typename D = typename std::decay<F>::type,
+             typename = typename std::enable_if<!std::is_same<D, small_task>::value>::type>
+    small_task(F&& f) : ops(&operations<D>::table)
+    {
+        operations<D>::construct(storage(), std::forward<F>(f));
+    }
+
+    small_task(small_task&& other) noexcept : ops(other.ops)
+    {
+        if (ops)
+        {
+            ops->relocate(other.storage(), storage());
+            other.ops = nullptr;
+        }
+    }
+
+    small_task& operator=(small_task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            ops = other.ops;
+            if (ops)
+            {
+                ops->relocate(other.storage(), storage());
+                other.ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~small_task()
+    {
+        reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ops != nullptr;
+    }
+
+    void operator()()
+    {
+        ops->invoke(storage());
+    }
+
+private:
+    /**
+     * Functions handling a stored callable of one type.
+     */
+    struct table_type
+    {
+        void (*invoke)(void*);
+        void (*relocate)(void* from, void* to) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    /**
+     * True if F is stored inline, which needs it to fit and to be nothrow move constructible so
+     * that small_task can be.
+     */
+    template<typename F>
+    struct is_inline : public std::integral_constant<bool,
+        sizeof(F) <= capacity && alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible<F>::value> { };
+
+    template<typename F, bool = is_inline<F>::value>
+    struct operations
+    {
+        template<typename G>
+        static void construct(void* storage, G&& f)
+        {
+            ::new (storage) F(std::forward<G>(f));
+        }
+
+        static void invoke(void* storage)
+        {
+            (*static_cast<F*>(storage))();
+        }
+
+        static void relocate(void* from, void* to) noexcept
+        {
+            ::new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        }
+
+        static void destroy(void* storage) noexcept
+        {
+            static_cast<F*>(storage)->~F();
+        }
+
+        static constexpr table_type table = {invoke, relocate, destroy};
+    };
+
+    template<typename F>
+    struct operations<F, false>
+    {
+        template<typename G>
+        static void construct(void* storage, G&& f)
+        {
+            *static_cast<F**>(storage) = new F(std::forward<G>(f));
+        }
+
+        static void invoke(void* storage)
+        {
+            (**static_cast<F**>(storage))();
+        }
+
+        static void relocate(void* from, void* to) noexcept
+        {
+            *static_cast<F**>(to) = *static_cast<F**>(from);
+        }
+
+        static void destroy(void* storage) noexcept
+        {
+            delete *static_cast<F**>(storage);
+        }
+
+        static constexpr table_type table = {invoke, relocate, destroy};
+    };
+
+    void* storage() noexcept
+    {
+        return &buffer;
+    }
+
+    void reset() noexcept
+    {
+        if (ops)
+        {
+            ops->destroy(storage());
+            ops = nullptr;
+        }
+    }
+
+    typename std::aligned_storage<capacity, alignof(std::max_align_t)>::type buffer;
+    const table_type* ops;
+};
+
+template<typename F, bool Inline>
+constexpr small_task::table_type small_task::operations<F, Inline>::table;
+
+template<typename F>
+constexpr small_task::table_type small_task::operations<F, false>::table;
+
+/**
+ * Simple fixed-size thread pool, a stand-in for whatever executor an application already has. Any
+ * type with an execute member function taking a move-only void() callable can be used with
+ * FORWARD_TO_MEMBER_ASYNC. Tasks are queued in a ring buffer that only grows, so submitting a
+ * task small enough to be stored inline in a small_task does not allocate once the queue has grown
+ * to its working size. execute is const so that const functions can submit to a pool held by
+ * value. The destructor runs the tasks still queued before joining the threads.
+ */
+class thread_pool
+{
+public:
+    explicit thread_pool(unsigned threads = std::thread::hardware_concurrency())
+        : queue(64), head(0), size(0), stopping(false)
+    {
+        threads = threads ? threads : 1;
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            workers.emplace_back([this]() { run(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    template<typename F>
+    void execute(F&& f) const
+    {
+        small_task task(std::forward<F>(f));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (size == queue.size())
+            {
+                grow();
+            }
+            queue[(head + size) % queue.size()] = std::move(task);
+            ++size;
+        }
+        ready.notify_one();
+    }
+
+private:
+    void grow() const
+    {
+        std::vector<small_task> larger(queue.size() * 2);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            larger[i] = std::move(queue[(head + i) % queue.size()]);
+        }
+        queue.swap(larger);
+        head = 0;
+    }
+
+    void run() const
+    {
+        for (;;)
+        {
+            small_task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [this]() { return stopping || size != 0; });
+                if (size == 0)
+                {
+                    return;
+                }
+                task = std::move(queue[head]);
+                head = (head + 1) % queue.size();
+                --size;
+            }
+            task();
+        }
+    }
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable ready;
+    mutable std::vector<small_task> queue;
+    mutable std::size_t head;
+    mutable std::size_t size;
+    bool stopping;
+    std::vector<std::thread> workers;
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * The state shared by a call submitted with FORWARD_TO_MEMBER_ASYNC and its future: the result of
+ * the call and whether it is done. Slots are recycled by the thread destroying the future, which
+ * is the last one touching them, through a free list of that thread, so a thread keeping as many
+ * futures alive as it did before allocates no new slot.
+ */
+template<typename R>
+class async_slot
+{
+public:
+    /**
+     * Returns a slot with a result yet to be stored, taken from the free list of the thread if it
+     * isn't empty.
+     */
+    static async_slot* acquire()
+    {
+        async_slot*& head = free_list().head;
+        async_slot* slot = head;
+        if (slot)
+        {
+            head = slot->next;
+        }
+        else
+        {
+            slot = new async_slot();
+        }
+        slot->done.store(false, std::memory_order_relaxed);
+        ::new (&slot->storage) call_result<R>();
+        return slot;
+    }
+
+    /**
+     * Destroys the result of a slot whose call is done and puts the slot on the free list of the
+     * thread.
+     */
+    static void recycle(async_slot* slot) noexcept
+    {
+        slot->result().~call_result<R>();
+        async_slot*& head = free_list().head;
+        slot->next = head;
+        head = slot;
+    }
+
+    call_result<R>& result() noexcept
+    {
+        return *static_cast<call_result<R>*>(static_cast<void*>(&storage));
+    }
+
+    std::atomic<bool> done;
+
+private:
+    /**
+     * The free list of a thread, whose slots are deleted when the thread exits.
+     */
+    struct list
+    {
+        async_slot* head = nullptr;
+
+        ~list()
+        {
+            while (async_slot* slot = head)
+            {
+                head = slot->next;
+                delete slot;
+            }
+        }
+    };
+
+    static list& free_list() noexcept
+    {
+        static thread_local list slots;
+        return slots;
+    }
+
+    typename std::aligned_storage<sizeof(call_result<R>), alignof(call_result<R>)>::type storage;
+    async_slot* next;
+};
+
+/**
+ * The task submitted to the executor. Call::call(self, args...) calls the method on the member of
+ * self and the arguments are stored by value. The result is stored in the slot, and a task
+ * destroyed without having run, such as one an executor throwing drops, stores a
+ * std::future_error with std::future_errc::broken_promise instead so that the future doesn't wait
+ * forever.
+ */
+template<typename Call, typename Self, typename R, typename... Args>
+struct async_task
+{
+    Self* self;
+    std::tuple<Args...> args;
+    async_slot<R>* slot;
+
+    /**
+     * The slot is acquired last, so that no slot is left behind if copying the arguments throws.
+     */
+    template<typename... TArgs>
+    explicit async_task(Self* self, TArgs&&... args)
+        : self(self), args(std::forward<TArgs>(args)...), slot(async_slot<R>::acquire()) { }
+
+    async_task(async_task&& other)
+        noexcept(std::is_nothrow_move_constructible<std::tuple<Args...>>::value)
+        : self(other.self), args(std::move(other.args)), slot(other.slot)
+    {
+        other.slot = nullptr;
+    }
+
+    ~async_task()
+    {
+        if (slot)
+        {
+            finish([]() -> R { throw std::future_error(std::future_errc::broken_promise); });
+        }
+    }
+
+    void operator()()
+    {
+        invoke(typename make_forward_member_indices<sizeof...(Args)>::type());
+    }
+
+    template<std::size_t... I>
+    void invoke(forward_member_indices<I...>)
+    {
+        finish([this]() -> R { return Call::call(self, std::move(std::get<I>(args))...); });
+    }
+
+    /**
+     * Stores the result of call in the slot and hands the slot over to the future, which may
+     * recycle it as soon as it is done.
+     */
+    template<typename F>
+    void finish(F&& call) noexcept
+    {
+        async_slot<R>* done = slot;
+        slot = nullptr;
+        done->result().run(call);
+        done->done.store(true, std::memory_order_release);
+    }
+};
+
+} /* End namespace detail. */
+
+namespace forward_to_member
+{
+
+/**
+ * The result of a call submitted by FORWARD_TO_MEMBER_ASYNC, which is kept in a slot recycled
+ * by the thread destroying the future, so that waiting for a call allocates nothing once that
+ * thread has as many slots as it keeps futures. Move-only, like std::future, but waiting spins and
+ * yields rather than blocking, as actor_future does, and the destructor waits for the call to
+ * have run since the slot is written to until then.
+ */
+template<typename R>
+class async_future
+{
+public:
+    async_future() noexcept : slot(nullptr) { }
+
+    explicit async_future(detail::async_slot<R>* slot) noexcept : slot(slot) { }
+
+    async_future(async_future&& other) noexcept : slot(other.slot)
+    {
+        other.slot = nullptr;
+    }
+
+    async_future& operator=(async_future&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            slot = other.slot;
+            other.slot = nullptr;
+        }
+        return *this;
+    }
+
+    ~async_future()
+    {
+        release();
+    }
+
+    bool valid() const noexcept
+    {
+        return slot != nullptr;
+    }
+
+    /**
+     * True once the call has run, so that get will not wait.
+     */
+    bool ready() const noexcept
+    {
+        return slot->done.load(std::memory_order_acquire);
+    }
+
+    void wait() const noexcept
+    {
+        for (unsigned spins = 0; !ready(); )
+        {
+            detail::spin_wait(spins);
+        }
+    }
+
+    /**
+     * Waits for the call and returns its result or throws its exception. The future is no longer
+     * valid afterwards.
+     */
+    R get()
+    {
+        wait();
+        struct guard
+        {
+            async_future* future;
+            ~guard() { future->release(); }
+        } releasing{this};
+        return slot->result().take();
+    }
+
+private:
+    /**
+     * Recycles the slot once the call has run.
+     */
+    void release() noexcept
+    {
+        if (slot)
+        {
+            wait();
+            detail::async_slot<R>::recycle(slot);
+            slot = nullptr;
+        }
+    }
+
+    detail::async_slot<R>* slot;
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * Submits a call of the method to executor and returns the future of its result. The executor is
+ * used without the volatile qualification it gets in volatile exposed functions, executors being
+ * synchronized on their own.
+ */
+template<typename Call, typename Executor, typename Self, typename... TArgs>
+auto async_submit(Executor&& executor, Self* self, TArgs&&... args)
+    -> forward_to_member::async_future<
+           decltype(Call::call(self, std::declval<typename std::decay<TArgs>::type>()...))>
+{
+    using R = decltype(Call::call(self, std::declval<typename std::decay<TArgs>::type>()...));
+    forward_to_member::async_future<R> future;
+    {
+        // The task is destroyed first if execute throws, so that the future has a result to wait
+        // for.
+        async_task<Call, Self, R, typename std::decay<TArgs>::type...> task(
+            self, std::forward<TArgs>(args)...);
+        future = forward_to_member::async_future<R>(task.slot);
+        using executor_type = typename std::remove_reference<Executor>::type;
+        const_cast<typename std::remove_volatile<executor_type>::type&>(executor).execute(
+            std::move(task));
+    }
+    return future;
+}
+
+} /* End namespace detail. */
+
+/**
+ * Declares one candidate of FORWARD_TO_MEMBER_ASYNC.
+ *
+ * @param cv The cv qualification of the candidate.
+ * @param condition The condition on the function traits and the member for the candidate.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, cv, condition)                 \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args) cv                                                                     \
+        -> typename std::enable_if<                                                                \
+               condition,                                                                          \
+               decltype(detail::async_submit<async_call_##m##_##f##_##n>(                          \
+                   executor, this, std::forward<TArgs>(args)...))>::type                           \
+    {                                                                                              \
+        return detail::async_submit<async_call_##m##_##f##_##n>(                                   \
+            executor, this, std::forward<TArgs>(args)...);                                         \
+    }
+
+/**
+ * Generates code which exposes a function in some class that submits a call of a method
+ * (potentially having several overloads) on one of the class's members to an executor, returning a
+ * forward_to_member::async_future of its result. The member can be anything FORWARD_TO_MEMBER_AS
+ * accepts and the exposed functions have the same cv qualifications as FORWARD_TO_MEMBER_AS would
+ * give them. The overload is classified for the decayed arguments since those are what the method
+ * is called with.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ * @param executor An expression, evaluated in the exposed function, for the executor to submit the
+ *                 call to. It must have an execute member function taking a move-only callable.
+ */
+#define FORWARD_TO_MEMBER_ASYNC(m, f, n, executor)                                                 \
+    using member_type_##m##_##f##_##n = detail::forward_member_underlying_type<decltype(m)>::type; \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    /**                                                                                            \
+     * The traits of the overload selected by the decayed arguments.                               \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    using async_traits_##m##_##f##_##n = function_traits_##m##_##f##_##n<                          \
+        member_type_##m##_##f##_##n&, typename std::decay<TArgs>::type...>;                        \
+                                                                                                   \
+    /**                                                                                            \
+     * Calls f on the member of self on the executor's thread. The object is made const if the     \
+     * overload selected is, as FORWARD_TO_MEMBER_AS does, so that it is also called through a     \
+     * pointer member.                                                                             \
+     */                                                                                            \
+    struct async_call_##m##_##f##_##n                                                              \
+    {                                                                                              \
+        template <typename Self, typename... TArgs>                                                \
+        static auto call(Self* self, TArgs&&... args)                                              \
+            -> decltype(detail::forward_member_target<                                             \
+                   async_traits_##m##_##f##_##n<TArgs...>::has_const, TArgs...>(self->m).f(        \
+                   std::forward<TArgs>(args)...))                                                  \
+        {                                                                                          \
+            return detail::forward_member_target<                                                  \
+                async_traits_##m##_##f##_##n<TArgs...>::has_const, TArgs...>(self->m).f(           \
+                std::forward<TArgs>(args)...);                                                     \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, ,                                  \
+        async_traits_##m##_##f##_##n<TArgs...>::is_plain)                                          \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, volatile,                          \
+        detail::is_volatile_accessible<decltype(m)>::value &&                                      \
+        async_traits_##m##_##f##_##n<TArgs...>::is_volatile)                                       \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, ,                                  \
+        !detail::is_volatile_accessible<decltype(m)>::value &&                                     \
+        async_traits_##m##_##f##_##n<TArgs...>::is_volatile)                                       \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, const,                             \
+        async_traits_##m##_##f##_##n<TArgs...>::is_const)                                          \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, const volatile,                    \
+        detail::is_volatile_accessible<decltype(m)>::value &&                                      \
+        async_traits_##m##_##f##_##n<TArgs...>::is_cv)                                             \
+    FORWARD_TO_MEMBER_DETAIL_ASYNC_CANDIDATE(m, f, n, executor, const,                             \
+        !detail::is_volatile_accessible<decltype(m)>::value &&                                     \
+        async_traits_##m##_##f##_##n<TArgs...>::is_cv)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_ASYNC_HPP__ */
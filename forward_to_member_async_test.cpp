@@ -0,0 +1,194 @@
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "forward_to_member_async.hpp"
+#include "test_allocation_counter.hpp"
+
+/**
+ * Simple structure for testing with overloads in several cv classes, overloads differing only by
+ * their constness, a function returning nothing, a function taking a move-only argument and a
+ * function throwing.
+ */
+struct account
+{
+    std::atomic<int> balance;
+    account() : balance(0) { }
+    int deposit(int amount) { return balance += amount; }
+    int deposit(int amount, int times) { return balance += amount * times; }
+    int read() const { return balance; }
+    int read(int scale) const volatile { return balance * scale; }
+    int kind() { return 1; }
+    int kind() const { return 2; }
+    void clear() { balance = 0; }
+    std::size_t consume(std::unique_ptr<std::string> s) { return s->size(); }
+    int sum(std::array<int, 64> values) const
+    {
+        int total = 0;
+        for (int value : values)
+        {
+            total += value;
+        }
+        return total;
+    }
+    int fail() const { throw std::runtime_error("failed"); }
+};
+
+/**
+ * Executor running calls inline, counting them.
+ */
+struct inline_executor
+{
+    int* count;
+
+    template<typename F>
+    void execute(F&& f) const
+    {
+        ++*count;
+        f();
+    }
+};
+
+/**
+ * Executor dropping calls without running them, or refusing them by throwing if refuse is true.
+ */
+struct dropping_executor
+{
+    bool refuse;
+
+    template<typename F>
+    void execute(F&&) const
+    {
+        if (refuse)
+        {
+            throw std::runtime_error("refused");
+        }
+    }
+};
+
+/**
+ * Forwards to an owned account on a pool held by value, and to a shared account and to the owned
+ * one through a pointer on an inline executor.
+ */
+struct bank
+{
+    forward_to_member::thread_pool pool;
+    account owned;
+    FORWARD_TO_MEMBER_ASYNC(owned, deposit, deposit_async, pool);
+    FORWARD_TO_MEMBER_ASYNC(owned, read, read_async, pool);
+    FORWARD_TO_MEMBER_ASYNC(owned, clear, clear_async, pool);
+    FORWARD_TO_MEMBER_ASYNC(owned, consume, consume_async, pool);
+    FORWARD_TO_MEMBER_ASYNC(owned, sum, sum_async, pool);
+    FORWARD_TO_MEMBER_ASYNC(owned, fail, fail_async, pool);
+
+    mutable int submitted;
+    std::shared_ptr<account> shared;
+    FORWARD_TO_MEMBER_ASYNC(shared, deposit, shared_deposit_async, (inline_executor{&submitted}));
+    FORWARD_TO_MEMBER_ASYNC(shared, read, shared_read_async, (inline_executor{&submitted}));
+
+    account* pointer;
+    FORWARD_TO_MEMBER_ASYNC(pointer, kind, pointer_kind_async, (inline_executor{&submitted}));
+
+    FORWARD_TO_MEMBER_ASYNC(owned, deposit, dropped_deposit_async, (dropping_executor{false}));
+    FORWARD_TO_MEMBER_ASYNC(owned, deposit, refused_deposit_async, (dropping_executor{true}));
+
+    bank() : pool(2), submitted(0), shared(std::make_shared<account>()), pointer(&owned) { }
+};
+
+int main()
+{
+    bank b;
+    const bank& bc = b;
+
+    // Results come back through the futures and every call runs exactly once.
+    std::vector<forward_to_member::async_future<int>> futures;
+    for (int i = 0; i < 100; ++i)
+    {
+        futures.push_back(b.deposit_async(1));
+    }
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+    assert(100 == bc.read_async().get());
+    assert(110 == b.deposit_async(5, 2).get());
+    assert(220 == bc.read_async(2).get());
+    b.clear_async().get();
+    assert(0 == bc.read_async().get());
+
+    // Lvalue arguments are copied, rvalues moved, and move-only arguments are supported.
+    int amount = 3;
+    assert(3 == b.deposit_async(amount).get());
+    std::unique_ptr<std::string> text(new std::string("hello"));
+    assert(5 == b.consume_async(std::move(text)).get());
+
+    // Argument packs too large to be stored inline still work.
+    std::array<int, 64> values;
+    values.fill(2);
+    assert(128 == bc.sum_async(values).get());
+
+    // Exceptions are delivered through the future.
+    bool thrown = false;
+    try
+    {
+        bc.fail_async().get();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Any executor can be used and the member can be a smart pointer.
+    assert(4 == b.shared_deposit_async(4).get());
+    assert(4 == bc.shared_read_async().get());
+    assert(2 == b.submitted);
+
+    // The const overload is called through a pointer, as FORWARD_TO_MEMBER_AS would call it.
+    assert(2 == b.pointer_kind_async().get());
+    assert(2 == bc.pointer_kind_async().get());
+
+    // A call dropped by the executor breaks its future, and one refused is not waited for.
+    thrown = false;
+    try
+    {
+        b.dropped_deposit_async(1).get();
+    }
+    catch (const std::future_error& e)
+    {
+        thrown = e.code() == std::future_errc::broken_promise;
+    }
+    assert(thrown);
+    thrown = false;
+    try
+    {
+        b.refused_deposit_async(1);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // A call allocates nothing once the queue has grown and the thread has a slot for its future.
+    for (int i = 0; i < 10; ++i)
+    {
+        b.deposit_async(1).get();
+    }
+    const long before = allocations;
+    for (int i = 0; i < 10; ++i)
+    {
+        b.deposit_async(1, 2).get();
+    }
+    assert(before == allocations);
+
+    // Calls submitted before the pool is destroyed still run.
+    bank* drained = new bank();
+    forward_to_member::async_future<int> last = drained->deposit_async(7);
+    delete drained;
+    assert(7 == last.get());
+}
@@ -0,0 +1,282 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_BATCHED macro, which exposes a function that doesn't
+ * call a per-item method of a member right away but buffers its arguments and hands them to a bulk
+ * method of the member all at once:
+ *
+ *     class index
+ *     {
+ *     public:
+ *         void insert(const std::string& key);
+ *         void insert_batch(std::string* keys, std::size_t count);
+ *     };
+ *
+ *     class catalog
+ *     {
+ *     private:
+ *         index i;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_BATCHED(i, insert, insert_batch, insert);
+ *     };
+ *
+ *     c.insert("a");       // Buffered.
+ *     c.flush_insert();    // Calls i.insert_batch with the buffered keys.
+ *
+ * The buffer is a fixed-capacity array in the class, so buffering a call never allocates. It is
+ * flushed when it fills, when flush_##n is called and when the class is destroyed. The destructor
+ * cannot report an exception of the bulk method, so call flush_##n first to see it. Moving the
+ * class moves the buffered calls along.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_BATCHED_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_BATCHED_HPP__
+
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include "forward_to_member.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Number of calls FORWARD_TO_MEMBER_BATCHED buffers before flushing.
+ */
+constexpr std::size_t default_batch_capacity = 64;
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * The type of the items of a batch of calls of a function taking Args: the decayed argument for a
+ * function of one argument and a tuple of the decayed arguments otherwise.
+ */
+template<typename... Args>
+struct forward_member_batch_item
+{
+    using type = std::tuple<typename std::decay<Args>::type...>;
+};
+
+template<typename Arg>
+struct forward_member_batch_item<Arg>
+{
+    using type = typename std::decay<Arg>::type;
+};
+
+/**
+ * Gets the item type of a batch of calls of the member function whose pointer type is F.
+ */
+template<typename F>
+struct forward_member_batch_signature;
+
+#define FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(qualifiers)                                       \
+    template<typename C, typename R, typename... Args>                                             \
+    struct forward_member_batch_signature<R (C::*)(Args...) qualifiers>                            \
+        : public forward_member_batch_item<Args...> { };
+
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE()
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(volatile)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const volatile)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(&)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const &)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(volatile &)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const volatile &)
+#if __cplusplus >= 201703L
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(volatile noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const volatile noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(& noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const & noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(volatile & noexcept)
+FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE(const volatile & noexcept)
+#endif
+
+#undef FORWARD_TO_MEMBER_DETAIL_BATCH_SIGNATURE
+
+/**
+ * Fixed-capacity buffer of the items of the calls to flush. The function flushing it is given by
+ * the exposed function along with its object each time it buffers a call, and the object is kept
+ * as its offset from the buffer, so the buffer of a copy or of a moved-to object flushes to the
+ * member of that object. Copies start empty and the calls buffered stay with the object that
+ * buffered them, while moving takes them along.
+ */
+template<typename Item, std::size_t Capacity>
+class forward_member_batch
+{
+public:
+    using flush_function = void (*)(void* owner, Item* items, std::size_t count);
+
+    forward_member_batch() noexcept : count(0), offset(0), flusher(nullptr) { }
+    forward_member_batch(const forward_member_batch&) noexcept : forward_member_batch() { }
+
+    forward_member_batch(forward_member_batch&& other)
+        noexcept(std::is_nothrow_move_constructible<Item>::value)
+        : forward_member_batch()
+    {
+        take(other);
+    }
+
+    forward_member_batch& operator=(const forward_member_batch&) noexcept
+    {
+        return *this;
+    }
+
+    /**
+     * Flushes the calls of this buffer, then takes those of other.
+     */
+    forward_member_batch& operator=(forward_member_batch&& other)
+    {
+        if (this != &other)
+        {
+            flush();
+            take(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Flushes the calls still buffered. An exception thrown by the bulk method is swallowed since
+     * this is called from a destructor, so flush explicitly to see it.
+     */
+    ~forward_member_batch()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    template<typename... TArgs>
+    void push(void* self, flush_function flush_with, TArgs&&... args)
+    {
+        offset = reinterpret_cast<char*>(this) - static_cast<char*>(self);
+        flusher = flush_with;
+        ::new (static_cast<void*>(items() + count)) Item(std::forward<TArgs>(args)...);
+        if (++count == Capacity)
+        {
+            flush();
+        }
+    }
+
+    /**
+     * Hands the buffered items to the bulk method, which may move from them. The buffer is emptied
+     * even if the bulk method throws.
+     */
+    void flush()
+    {
+        if (count)
+        {
+            clear_on_exit clear{*this};
+            flusher(reinterpret_cast<char*>(this) - offset, items(), count);
+        }
+    }
+
+    std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+private:
+    struct clear_on_exit
+    {
+        forward_member_batch& batch;
+
+        ~clear_on_exit()
+        {
+            for (std::size_t i = 0; i < batch.count; ++i)
+            {
+                batch.items()[i].~Item();
+            }
+            batch.count = 0;
+        }
+    };
+
+    /**
+     * Moves the calls buffered by other, which is left empty, into this empty buffer.
+     */
+    void take(forward_member_batch& other) noexcept(std::is_nothrow_move_constructible<Item>::value)
+    {
+        offset = other.offset;
+        flusher = other.flusher;
+        clear_on_exit clear{other};
+        for (; count < other.count; ++count)
+        {
+            ::new (static_cast<void*>(items() + count)) Item(std::move(other.items()[count]));
+        }
+    }
+
+    Item* items() noexcept
+    {
+        return reinterpret_cast<Item*>(&storage);
+    }
+
+    typename std::aligned_storage<sizeof(Item) * Capacity, alignof(Item)>::type storage;
+    std::size_t count;
+    std::ptrdiff_t offset;
+    flush_function flusher;
+};
+
+} /* End namespace detail. */
+
+/**
+ * Generates code which exposes a function in some class that buffers calls of a method of one of
+ * the class's members and passes them to a bulk method of the member in batches, along with
+ * flush_##n to flush the buffer. The member can be a value, reference, pointer or pointer-like
+ * type. The method must not be overloaded, since its parameters give the type of the items: the
+ * decayed parameter for a method taking one and a std::tuple of the decayed parameters otherwise.
+ * The bulk method is called with a pointer to the first item and the number of items. The exposed
+ * function takes the arguments of the method and returns nothing. The buffer is a member of the
+ * class and is not synchronized, so the class must not be used from several threads at once.
+ *
+ * @param m The name of the member variable on which the bulk function should be called.
+ * @param f The name of the per-item function of the member variable, giving the item type.
+ * @param bulk_f The name of the function of the member variable taking a batch of items.
+ * @param n The name of the function to expose in the class.
+ * @param capacity The number of calls buffered before flushing.
+ */
+#define FORWARD_TO_MEMBER_BATCHED_CAPACITY(m, f, bulk_f, n, capacity)                              \
+    using batch_item_##m##_##f##_##n = detail::forward_member_batch_signature<                     \
+        decltype(&detail::forward_member_underlying_type<decltype(m)>::type::f)>::type;            \
+                                                                                                   \
+    detail::forward_member_batch<batch_item_##m##_##f##_##n, capacity> batch_##n;                  \
+                                                                                                   \
+    /**                                                                                            \
+     * Passes a batch of items to the bulk function of the member of the object self points to.   \
+     */                                                                                            \
+    template <typename Self>                                                                       \
+    static void batch_flush_##m##_##f##_##n(void* self, batch_item_##m##_##f##_##n* items,         \
+                                            std::size_t count)                                     \
+    {                                                                                              \
+        detail::forward_member_deref<>(static_cast<Self*>(self)->m).bulk_f(items, count);          \
+    }                                                                                              \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args)                                                                        \
+        -> typename std::enable_if<                                                                \
+               std::is_constructible<batch_item_##m##_##f##_##n, TArgs&&...>::value>::type         \
+    {                                                                                              \
+        batch_##n.push(this,                                                                       \
+                       &batch_flush_##m##_##f##_##n<                                               \
+                           typename std::remove_pointer<decltype(this)>::type>,                    \
+                       std::forward<TArgs>(args)...);                                              \
+    }                                                                                              \
+                                                                                                   \
+    void flush_##n()                                                                               \
+    {                                                                                              \
+        batch_##n.flush();                                                                         \
+    }
+
+/**
+ * Same as FORWARD_TO_MEMBER_BATCHED_CAPACITY with forward_to_member::default_batch_capacity.
+ */
+#define FORWARD_TO_MEMBER_BATCHED(m, f, bulk_f, n)                                                 \
+    FORWARD_TO_MEMBER_BATCHED_CAPACITY(m, f, bulk_f, n, forward_to_member::default_batch_capacity)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_BATCHED_HPP__ */
@@ -0,0 +1,159 @@
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "forward_to_member_batched.hpp"
+
+/**
+ * Simple structure for testing with per-item methods and their bulk versions, recording the
+ * batches it receives.
+ */
+struct store
+{
+    std::vector<std::string> keys;
+    std::vector<std::size_t> batches;
+    std::vector<std::pair<int, int>> pairs;
+    std::vector<int> owned;
+
+    void insert(const std::string& key) { keys.push_back(key); }
+    void insert_batch(std::string* items, std::size_t count)
+    {
+        batches.push_back(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            keys.push_back(std::move(items[i]));
+        }
+    }
+
+    void link(int from, int to) { pairs.emplace_back(from, to); }
+    void link_batch(std::tuple<int, int>* items, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            pairs.emplace_back(std::get<0>(items[i]), std::get<1>(items[i]));
+        }
+    }
+
+    void adopt(std::unique_ptr<int> p) { owned.push_back(*p); }
+    void adopt_batch(std::unique_ptr<int>* items, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::unique_ptr<int> p = std::move(items[i]);
+            owned.push_back(*p);
+        }
+    }
+
+    void fail(int) { }
+    void fail_batch(int*, std::size_t) { throw std::runtime_error("failed"); }
+};
+
+/**
+ * Forwards to a store held by value and to one held through a pointer.
+ */
+struct catalog
+{
+    store s;
+    FORWARD_TO_MEMBER_BATCHED_CAPACITY(s, insert, insert_batch, insert, 4);
+    FORWARD_TO_MEMBER_BATCHED(s, link, link_batch, link);
+    FORWARD_TO_MEMBER_BATCHED(s, adopt, adopt_batch, adopt);
+    FORWARD_TO_MEMBER_BATCHED(s, fail, fail_batch, fail);
+
+    store* remote;
+    FORWARD_TO_MEMBER_BATCHED_CAPACITY(remote, insert, insert_batch, remote_insert, 2);
+
+    explicit catalog(store* remote) : remote(remote) { }
+};
+
+int main()
+{
+    store remote;
+    {
+        catalog c(&remote);
+
+        // Calls are buffered until the buffer fills, then passed in one batch.
+        c.insert("a");
+        c.insert(std::string("b"));
+        c.insert("c");
+        assert(c.s.keys.empty() && 3 == c.batch_insert.size());
+        c.insert("d");
+        assert(4 == c.s.keys.size() && "d" == c.s.keys.back());
+        assert(1 == c.s.batches.size() && 4 == c.s.batches[0]);
+        assert(0 == c.batch_insert.size());
+
+        // An explicit flush passes a partial batch.
+        c.insert("e");
+        c.flush_insert();
+        assert(5 == c.s.keys.size() && 1 == c.s.batches.back());
+        c.flush_insert();
+        assert(2 == c.s.batches.size());
+
+        // Functions of several arguments are batched as tuples and move-only arguments are moved.
+        c.link(1, 2);
+        c.link(3, 4);
+        std::unique_ptr<int> p(new int(7));
+        c.adopt(std::move(p));
+        c.flush_link();
+        c.flush_adopt();
+        assert(2 == c.s.pairs.size() && 3 == c.s.pairs[1].first && 4 == c.s.pairs[1].second);
+        assert(1 == c.s.owned.size() && 7 == c.s.owned[0]);
+
+        // The buffer is emptied even if the bulk function throws.
+        c.fail(1);
+        bool thrown = false;
+        try
+        {
+            c.flush_fail();
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown && 0 == c.batch_fail.size());
+
+        // Pointer members are reached through the pointer.
+        c.remote_insert("x");
+        c.remote_insert("y");
+        c.remote_insert("z");
+        assert(2 == remote.keys.size());
+
+        // A copy starts empty and flushes to its own member.
+        c.insert("f");
+        catalog copy = c;
+        assert(0 == copy.batch_insert.size() && 1 == c.batch_insert.size());
+        copy.insert("g");
+        copy.flush_insert();
+        assert("g" == copy.s.keys.back() && "e" == c.s.keys.back());
+
+        // Moving takes the buffered calls along, and they are flushed to the member of the
+        // moved-to object.
+        catalog moved(std::move(c));
+        assert(0 == c.batch_insert.size() && 1 == moved.batch_insert.size());
+        moved.flush_insert();
+        assert("f" == moved.s.keys.back() && 6 == moved.s.keys.size());
+        catalog assigned(&remote);
+        moved.insert("h");
+        assigned = std::move(moved);
+        assert(0 == moved.batch_insert.size() && 1 == assigned.batch_insert.size());
+        assert(0 == moved.batch_remote_insert.size() && 1 == assigned.batch_remote_insert.size());
+        assigned.flush_insert();
+        assert("h" == assigned.s.keys.back() && 7 == assigned.s.keys.size());
+    }
+
+    // Buffered calls are flushed on destruction.
+    assert(3 == remote.keys.size() && "z" == remote.keys.back());
+
+    // A moved-from buffer is empty and flushes nothing when it is destroyed.
+    store other;
+    {
+        catalog source(&other);
+        source.remote_insert("m");
+        {
+            catalog target(std::move(source));
+        }
+        assert(1 == other.keys.size() && 1 == other.batches.size());
+    }
+    assert(1 == other.keys.size() && 1 == other.batches.size() && "m" == other.keys.back());
+}
@@ -0,0 +1,43 @@
+/**
+ * This file provides the specifiers shared by the templates of forward_to_member_core.hpp and the
+ * functions the FORWARD_TO_MEMBER macros expose, so that both agree when the macros come from
+ * forward_to_member_macros.hpp and the templates from the forward_to_member module. It includes
+ * nothing.
+ *
+ * Defining FORWARD_TO_MEMBER_ALWAYS_INLINE before including any of the headers selects the debug
+ * build mode, meant for builds without optimization (-O0 or -Og): the exposed functions and the
+ * detail templates between them and the member function are always inlined, so a forwarded call
+ * costs the same as calling the member function directly, and are marked artificial so a debugger
+ * steps over them into the member function. A module must be built with the same definition as the
+ * translation units importing it.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_CONFIG_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_CONFIG_HPP__
+
+/**
+ * constexpr for the exposed functions that are not const. Before C++14 a constexpr member function
+ * is implicitly const, so these can only be constexpr from C++14 on. The const ones, and the
+ * detail templates they call, are always constexpr.
+ */
+#if __cplusplus >= 201402L
+#define FORWARD_TO_MEMBER_DETAIL_CONSTEXPR constexpr
+#else
+#define FORWARD_TO_MEMBER_DETAIL_CONSTEXPR
+#endif
+
+/**
+ * Leading specifiers of the exposed functions and of the detail templates they call. They are
+ * implicitly inline, so this is empty unless FORWARD_TO_MEMBER_ALWAYS_INLINE is defined, in which
+ * case it forces the inlining where the compiler supports it. GCC wants always_inline functions
+ * declared inline, hence the redundant keyword.
+ */
+#if defined(FORWARD_TO_MEMBER_ALWAYS_INLINE) && defined(__GNUC__)
+#define FORWARD_TO_MEMBER_DETAIL_INLINE __attribute__((__always_inline__, __artificial__)) inline
+#elif defined(FORWARD_TO_MEMBER_ALWAYS_INLINE) && defined(_MSC_VER)
+#define FORWARD_TO_MEMBER_DETAIL_INLINE __forceinline
+#else
+#define FORWARD_TO_MEMBER_DETAIL_INLINE
+#endif
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_CONFIG_HPP__ */
@@ -0,0 +1,554 @@
+/**
+ * This file provides the templates behind the FORWARD_TO_MEMBER macros: the pointer_like_traits
+ * customization point and the detail helpers the exposed functions call. It only depends on
+ * <type_traits> and <utility>. Support for the standard pointer-like types lives in
+ * forward_to_member_memory.hpp (std::shared_ptr and std::unique_ptr) and
+ * forward_to_member_functional.hpp (std::reference_wrapper), so a translation unit whose members
+ * are values, references and raw pointers can include this file alone and never parse <memory> or
+ * <functional>. forward_to_member.hpp includes all of them.
+ *
+ * Only FORWARD_TO_MEMBER_ALWAYS_INLINE (see forward_to_member_config.hpp), which adds attributes to
+ * the templates, changes anything here, so the file can be built as a header unit, and
+ * forward_to_member.cppm exports it as the forward_to_member module.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_CORE_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_CORE_HPP__
+
+#include <type_traits>
+#include <utility>
+#include "forward_to_member_config.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Customization point describing a pointer-like class type (a smart pointer, a reference wrapper,
+ * etc.) through which FORWARD_TO_MEMBER_AS can reach the object whose method is invoked. The base
+ * case is empty, meaning the type is not pointer-like and is treated as a value. A specialization
+ * must provide:
+ *
+ *     using element_type = ...;            // The pointed-to type, possibly cv qualified.
+ *     static constexpr bool volatile_get;  // True if deref accepts a volatile pointer.
+ *     static element_type& deref(const P&) noexcept;
+ *
+ * When volatile_get is true deref must take a const volatile P& instead, which allows the exposed
+ * function to be volatile. Specializations are looked up with cv qualifiers removed from P.
+ */
+template<typename P>
+struct pointer_like_traits { };
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * Gets the pointer_like_traits for a possibly cv qualified or reference type.
+ */
+template<typename P>
+using pointer_like_traits = forward_to_member::pointer_like_traits<
+    typename std::remove_cv<typename std::remove_reference<P>::type>::type>;
+
+/**
+ * Base case for is_pointer_like. Anything without an element_type in its pointer_like_traits is
+ * not pointer-like.
+ */
+template<typename P, typename = void>
+struct is_pointer_like : public std::false_type { };
+
+/**
+ * Specialization for types whose pointer_like_traits have been specialized.
+ */
+template<typename P>
+struct is_pointer_like<P, typename std::conditional<
+                              true, void, typename pointer_like_traits<P>::element_type>::type>
+    : public std::true_type { };
+
+/**
+ * True if the object behind a member of type P can still be reached when the member is volatile,
+ * which is the case for everything except pointer-like types whose deref is not volatile.
+ */
+template<typename P, bool = is_pointer_like<P>::value>
+struct is_volatile_accessible : public std::true_type { };
+
+/**
+ * Specialization for pointer-like types, which defer to their traits.
+ */
+template<typename P>
+struct is_volatile_accessible<P, true>
+    : public std::integral_constant<bool, pointer_like_traits<P>::volatile_get> { };
+
+/**
+ * Gets the "underlying" (i.e. raw, no const, no volatile, no pointer, and no reference modifiers on
+ * the type. This is the general case.
+ */
+template<typename T, bool = is_pointer_like<T>::value>
+struct forward_member_underlying_type
+{
+    using type = typename std::remove_cv<
+                     typename std::remove_pointer<
+                         typename std::remove_reference<T>::type>::type>::type;
+};
+
+/**
+ * Gets the "underlying" (i.e. raw, no const, no volatile, no pointer, and no reference modifiers on
+ * the type. This is the special case for pointer-like types where we extract the pointed-to type.
+ */
+template<typename T>
+struct forward_member_underlying_type<T, true>
+{
+    using type = typename std::remove_cv<
+                     typename std::remove_pointer<
+                         typename std::remove_reference<
+                             typename pointer_like_traits<T>::element_type>::type>::type>::type;
+};
+
+/**
+ * True if a member of type D belongs to the object holding it, i.e. it is a value rather than a
+ * reference, pointer or pointer-like member, and so may be moved from when that object is an
+ * rvalue.
+ */
+template<typename D>
+struct is_owned_member : public std::integral_constant<bool, !std::is_reference<D>::value &&
+                                                             !std::is_pointer<D>::value &&
+                                                             !is_pointer_like<D>::value> { };
+
+/**
+ * The type of the object the exposed functions call a function of a member of type D on, given T,
+ * the member's underlying type. Those qualified with & call it on an lvalue and those qualified
+ * with && on an rvalue if the member is owned.
+ */
+template<typename D, typename T>
+using forward_member_lvalue = T&;
+
+template<typename D, typename T>
+using forward_member_rvalue = typename std::conditional<is_owned_member<D>::value, T&&, T&>::type;
+
+/**
+ * T with the value category of an object that a forwarding reference deduced as Member, which is an
+ * lvalue if Member is an lvalue reference and an rvalue otherwise.
+ */
+template<typename Member, typename T>
+using forward_member_object = typename std::conditional<std::is_lvalue_reference<Member>::value,
+                                                        T&, T&&>::type;
+
+/**
+ * Gets object, made const if Const is true, with its value category.
+ */
+template<bool Const, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_as_const(T&& object) noexcept
+    -> forward_member_object<T, typename std::conditional<
+           Const, const typename std::remove_reference<T>::type,
+           typename std::remove_reference<T>::type>::type>
+{
+    return static_cast<T&&>(object);
+}
+
+/**
+ * Gets a member of type D as an rvalue if it is owned, for the exposed functions qualified with &&.
+ * Other members are returned as lvalues since the object being an rvalue says nothing about them.
+ */
+template<typename D, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_move(T& member) noexcept
+    -> typename std::conditional<is_owned_member<D>::value, T&&, T&>::type
+{
+    return static_cast<typename std::conditional<is_owned_member<D>::value, T&&, T&>::type>(member);
+}
+
+/**
+ * What the accessor of a field of type F, generated by FORWARD_TO_MEMBER_FIELD, returns on an
+ * rvalue for a member of type D: the field moved out by value if the member is owned and a
+ * reference to it otherwise. Arrays can't be returned by value, so an owned one is returned by
+ * rvalue reference.
+ */
+template<typename D, typename F>
+struct forward_member_field
+{
+    static constexpr bool by_value = is_owned_member<D>::value && !std::is_array<F>::value;
+    static constexpr bool nothrow_rvalue =
+        !by_value || std::is_nothrow_move_constructible<F>::value;
+
+    using rvalue = typename std::conditional<by_value, F, forward_member_rvalue<D, F>>::type;
+};
+
+/**
+ * Gets the object behind a value or reference member, which is the member itself with its value
+ * category. The leading TArgs are the arguments of the exposed function calling this. They are
+ * unused but make the call dependent, so a member that cannot be dereferenced (e.g. a volatile
+ * shared_ptr) only removes the exposed function from overload resolution.
+ */
+template<typename... TArgs, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_deref(T&& member) noexcept
+    -> typename std::enable_if<!is_pointer_like<T>::value &&
+                               !std::is_pointer<typename std::remove_reference<T>::type>::value,
+                               T&&>::type
+{
+    return static_cast<T&&>(member);
+}
+
+/**
+ * Gets the object behind a pointer member.
+ */
+template<typename... TArgs, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr T& forward_member_deref(T* member) noexcept
+{
+    return *member;
+}
+
+/**
+ * Gets the object behind a pointer-like member through its pointer_like_traits.
+ */
+template<typename... TArgs, typename P>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_deref(P& member) noexcept
+    -> typename std::enable_if<is_pointer_like<P>::value,
+                               decltype(pointer_like_traits<P>::deref(member))>::type
+{
+    return pointer_like_traits<P>::deref(member);
+}
+
+/**
+ * True if every one of Bs is true.
+ */
+template<bool... Bs>
+struct forward_member_all
+    : public std::is_same<forward_member_all<true, Bs...>, forward_member_all<Bs..., true>> { };
+
+/**
+ * Stands for the last of a path of members of types Ds, each a member of the object the one before
+ * it is or points to, where the traits of a member are looked up for one exposed by
+ * FORWARD_TO_MEMBER_PATH. The object at the end of the path belongs to the object holding the
+ * path only if every member is owned, and can be reached through a volatile object only if every
+ * member can.
+ */
+template<typename... Ds>
+struct forward_member_path { };
+
+template<typename... Ds>
+struct is_owned_member<forward_member_path<Ds...>>
+    : public forward_member_all<is_owned_member<Ds>::value...> { };
+
+template<typename... Ds>
+struct is_volatile_accessible<forward_member_path<Ds...>, false>
+    : public forward_member_all<is_volatile_accessible<Ds>::value...> { };
+
+/**
+ * To with the cv qualification of From added.
+ */
+template<typename From, typename To>
+struct forward_member_copy_cv
+{
+    using c = typename std::conditional<std::is_const<From>::value, const To, To>::type;
+    using type = typename std::conditional<std::is_volatile<From>::value, volatile c, c>::type;
+};
+
+/**
+ * Gets the object behind one member of a path, as forward_member_deref does, with the cv
+ * qualification of the member added. A const or volatile object along a path thus makes every
+ * object reached from it const or volatile, through pointers as well as values, so the exposed
+ * function gets the cv qualification computed over the whole path.
+ */
+template<typename... TArgs, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_hop(T&& member) noexcept
+    -> forward_member_object<
+           decltype(forward_member_deref<TArgs...>(static_cast<T&&>(member))),
+           typename forward_member_copy_cv<
+               typename std::remove_reference<T>::type,
+               typename std::remove_reference<decltype(forward_member_deref<TArgs...>(
+                   static_cast<T&&>(member)))>::type>::type>
+{
+    return forward_member_deref<TArgs...>(static_cast<T&&>(member));
+}
+
+/**
+ * The member function pointer types an overload of a function of T taking Args and returning R can
+ * have. Object is T& or T&&, the ref-qualified pointers are those whose ref-qualifier matches it
+ * and c_lvalue is the const & one, which can also be called on an rvalue.
+ */
+template<typename Object, typename R, typename... Args>
+struct forward_member_signatures
+{
+    using T = typename std::remove_reference<Object>::type;
+    static constexpr bool lvalue = std::is_lvalue_reference<Object>::value;
+
+    using c  = R (T::*)(Args...) const;
+    using v  = R (T::*)(Args...) volatile;
+    using cv = R (T::*)(Args...) const volatile;
+
+    using p_ref  = typename std::conditional<lvalue, R (T::*)(Args...) &,
+                                                     R (T::*)(Args...) &&>::type;
+    using c_ref  = typename std::conditional<lvalue, R (T::*)(Args...) const &,
+                                                     R (T::*)(Args...) const &&>::type;
+    using v_ref  = typename std::conditional<lvalue, R (T::*)(Args...) volatile &,
+                                                     R (T::*)(Args...) volatile &&>::type;
+    using cv_ref = typename std::conditional<lvalue, R (T::*)(Args...) const volatile &,
+                                                     R (T::*)(Args...) const volatile &&>::type;
+
+    using c_lvalue = R (T::*)(Args...) const &;
+};
+
+/**
+ * Tag used to try the overloads of the C++11 classification in order. Overload resolution prefers
+ * the conversion to the closest base, so higher priorities are tried first.
+ */
+template<int N>
+struct forward_member_priority : public forward_member_priority<N - 1> { };
+
+template<>
+struct forward_member_priority<0> { };
+
+/**
+ * The cv qualification of the member function overload selected by a set of arguments. The
+ * function traits generated by FORWARD_TO_MEMBER_AS classify an overload into exactly one of these,
+ * whether or not it is also ref-qualified.
+ */
+enum class forward_member_qualifier
+{
+    plain,
+    c,
+    v,
+    cv
+};
+
+/**
+ * The templates below classify the overloads of the functions forwarded by FORWARD_TO_MEMBER_AS
+ * and the macros built on it. They are shared by every forwarded function and reach the function
+ * through Tag, the method-access tag FORWARD_TO_MEMBER_DETAIL_TRAITS generates for it, which
+ * declares, for use in unevaluated operands only:
+ *
+ *     template <typename Signature, typename T>
+ *     static auto address() -> Signature;  // The type of static_cast<Signature>(&T::f).
+ *
+ *     template <typename T, typename... TArgs>
+ *     static auto call(T&& object, TArgs&&... args);  // The type of object.f(args...).
+ *
+ * both of which are removed from overload resolution when the expression is invalid.
+ */
+#if __cplusplus >= 201703L
+
+/**
+ * True if the overload set of the function of Tag can be cast to the member function pointer
+ * Signature of T.
+ */
+template<typename Tag, typename Signature, typename T, typename = void>
+struct forward_member_castable : public std::false_type { };
+
+template<typename Tag, typename Signature, typename T>
+struct forward_member_castable<Tag, Signature, T,
+                               std::void_t<decltype(Tag::template address<Signature, T>())>>
+    : public std::true_type { };
+
+/**
+ * Classifies the overload of the function of Tag selected by TArgs on an object of type T. This is
+ * the C++17 version, the return type is detected with void_t and the casts are tried one at a time
+ * with if constexpr so no further cast is instantiated once one succeeds. This is the base case,
+ * the function cannot be called with TArgs at all. Classifying the overload as plain matches the
+ * C++11 version and leaves the error to the exposed function's return type.
+ */
+template<typename Tag, typename T, typename Void, typename... TArgs>
+struct forward_member_classify
+{
+    static constexpr forward_member_qualifier get()
+    {
+        return forward_member_qualifier::plain;
+    }
+};
+
+/**
+ * The function can be called with TArgs, so try each cv qualified signature in turn, with or
+ * without a ref-qualifier. An rvalue can also bind to a const & overload, but only if no overload
+ * with a && ref-qualifier matches.
+ */
+template<typename Tag, typename T, typename... TArgs>
+struct forward_member_classify<
+    Tag, T, std::void_t<decltype(Tag::call(std::declval<T>(), std::declval<TArgs>()...))>, TArgs...>
+{
+    using S = forward_member_signatures<
+                  T, decltype(Tag::call(std::declval<T>(), std::declval<TArgs>()...)), TArgs...>;
+
+    template<typename Signature>
+    using castable = forward_member_castable<Tag, Signature,
+                                             typename std::remove_reference<T>::type>;
+
+    static constexpr forward_member_qualifier get()
+    {
+        if constexpr (castable<typename S::c>::value || castable<typename S::c_ref>::value)
+            return forward_member_qualifier::c;
+        else if constexpr (castable<typename S::v>::value || castable<typename S::v_ref>::value)
+            return forward_member_qualifier::v;
+        else if constexpr (castable<typename S::cv>::value || castable<typename S::cv_ref>::value)
+            return forward_member_qualifier::cv;
+        else if constexpr (!castable<typename S::p_ref>::value &&
+                           castable<typename S::c_lvalue>::value)
+            return forward_member_qualifier::c;
+        else
+            return forward_member_qualifier::plain;
+    }
+};
+
+template<typename Tag, typename T, typename... TArgs>
+constexpr forward_member_qualifier forward_member_classified =
+    forward_member_classify<Tag, T, void, TArgs...>::get();
+
+#else
+
+/**
+ * Classifies the overload of the function of Tag selected by a set of arguments on an object of
+ * type T. This is the C++11 version, a single overload resolution of check picks the kind. The
+ * priority tags order the overloads the same way as the C++17 version.
+ */
+template<typename Tag, typename T>
+struct forward_member_classify
+{
+    using object_type = typename std::remove_reference<T>::type;
+
+    /**
+     * Each type of function gets a struct whose size is one more than the value of its
+     * forward_member_qualifier so the result of overload resolution converts to a kind.
+     */
+    typedef struct { char pad[1]; } p_struct;
+    typedef struct { char pad[2]; } c_struct;
+    typedef struct { char pad[3]; } v_struct;
+    typedef struct { char pad[4]; } cv_struct;
+
+    /**
+     * The member function pointer types an overload selected by UArgs can have.
+     */
+    template<typename... UArgs>
+    using signatures = forward_member_signatures<
+        T, decltype(Tag::call(std::declval<T>(), std::declval<UArgs>()...)), UArgs...>;
+
+    /**
+     * Overloads for const member functions. If we can cast the member function to a
+     * "retval (args...) const", with or without a ref-qualifier matching the object, then the
+     * function is a const function.
+     */
+    template<typename... UArgs>
+    static c_struct check(decltype(Tag::template address<typename signatures<UArgs...>::c,
+                                                         object_type>(),
+                                   forward_member_priority<5>()));
+
+    template<typename... UArgs>
+    static c_struct check(decltype(Tag::template address<typename signatures<UArgs...>::c_ref,
+                                                         object_type>(),
+                                   forward_member_priority<5>()));
+
+    /**
+     * Overloads for volatile member functions. If we can cast the member function to a
+     * "retval (args...) volatile", with or without a ref-qualifier matching the object, then the
+     * function is a volatile function.
+     */
+    template<typename... UArgs>
+    static v_struct check(decltype(Tag::template address<typename signatures<UArgs...>::v,
+                                                         object_type>(),
+                                   forward_member_priority<4>()));
+
+    template<typename... UArgs>
+    static v_struct check(decltype(Tag::template address<typename signatures<UArgs...>::v_ref,
+                                                         object_type>(),
+                                   forward_member_priority<4>()));
+
+    /**
+     * Overloads for const volatile member functions. If we can cast the member function to a
+     * "retval (args...) const volatile", with or without a ref-qualifier matching the object, then
+     * the function is a const volatile function.
+     */
+    template<typename... UArgs>
+    static cv_struct check(decltype(Tag::template address<typename signatures<UArgs...>::cv,
+                                                          object_type>(),
+                                    forward_member_priority<3>()));
+
+    template<typename... UArgs>
+    static cv_struct check(decltype(Tag::template address<typename signatures<UArgs...>::cv_ref,
+                                                          object_type>(),
+                                    forward_member_priority<3>()));
+
+    /**
+     * Overload for ref-qualified plain member functions. It has to be tried explicitly so a &&
+     * overload is preferred to the const & overload below.
+     */
+    template<typename... UArgs>
+    static p_struct check(decltype(Tag::template address<typename signatures<UArgs...>::p_ref,
+                                                         object_type>(),
+                                   forward_member_priority<2>()));
+
+    /**
+     * Overload for const & member functions called on an rvalue, which can bind to them.
+     */
+    template<typename... UArgs>
+    static c_struct check(decltype(Tag::template address<typename signatures<UArgs...>::c_lvalue,
+                                                         object_type>(),
+                                   forward_member_priority<1>()));
+
+    /**
+     * Overload for undecorated (plain) member functions. If all of the above overloads fail then
+     * this overload will be selected.
+     */
+    template<typename... UArgs>
+    static p_struct check(...);
+};
+
+#endif
+
+/**
+ * Traits of the overload of the function of Tag selected by TArgs. T is a reference to the
+ * underlying type of the member whose value category is the one the function is called with. The
+ * overload is classified once into kind and every other trait is derived from it. The instances
+ * depend only on Tag, T and TArgs, so every function forwarding to the same tag shares them.
+ */
+template<typename Tag, typename T, typename... TArgs>
+struct forward_member_traits
+{
+#if __cplusplus >= 201703L
+    static constexpr forward_member_qualifier kind = forward_member_classified<Tag, T, TArgs...>;
+#else
+    static constexpr forward_member_qualifier kind = static_cast<forward_member_qualifier>(
+        sizeof(forward_member_classify<Tag, T>::template check<TArgs...>(
+            forward_member_priority<5>())) - 1);
+#endif
+
+    static constexpr bool is_plain     = kind == forward_member_qualifier::plain;
+    static constexpr bool is_const     = kind == forward_member_qualifier::c;
+    static constexpr bool is_volatile  = kind == forward_member_qualifier::v;
+    static constexpr bool is_cv        = kind == forward_member_qualifier::cv;
+    static constexpr bool has_const    = is_const || is_cv;
+    static constexpr bool has_volatile = is_volatile || is_cv;
+};
+
+/**
+ * Compile-time list of indices, used by the side headers to unpack the stored arguments of a call.
+ * It is std::index_sequence before C++14.
+ */
+template<std::size_t... I>
+struct forward_member_indices { };
+
+template<std::size_t N, std::size_t... I>
+struct make_forward_member_indices : public make_forward_member_indices<N - 1, N - 1, I...> { };
+
+template<std::size_t... I>
+struct make_forward_member_indices<0, I...>
+{
+    using type = forward_member_indices<I...>;
+};
+
+/**
+ * Gets the object behind a member, as forward_member_deref does, on which to call a function whose
+ * selected overload is const if Const is true. The object is then made const whatever the kind of
+ * member, value, reference, pointer or pointer-like, so the const overload is called as classified.
+ * Every forwarder gets the object it calls a function on through this, and it depends only on the
+ * type of the member, so every function forwarding to members of the same type shares it.
+ */
+template<bool Const, typename... TArgs, typename T>
+FORWARD_TO_MEMBER_DETAIL_INLINE constexpr auto forward_member_target(T&& member) noexcept
+    -> decltype(forward_member_as_const<Const>(
+           forward_member_deref<TArgs...>(static_cast<T&&>(member))))
+{
+    return forward_member_as_const<Const>(
+        forward_member_deref<TArgs...>(static_cast<T&&>(member)));
+}
+
+} /* End namespace detail. */
+
+#include "forward_to_member_macros.hpp"
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_CORE_HPP__ */
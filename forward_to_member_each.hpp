@@ -0,0 +1,469 @@
+/**
+ * This file provides the FORWARD_TO_EACH_MEMBER macro, a variant of FORWARD_TO_MEMBER_AS for a
+ * member that is a container. The exposed function calls the method on every element of the
+ * container instead of on a single object:
+ *
+ *     class pool
+ *     {
+ *     private:
+ *         std::vector<worker> workers;
+ *
+ *     public:
+ *         FORWARD_TO_EACH_MEMBER(workers, score, score_all);
+ *     };
+ *
+ *     pool p;
+ *     p.score_all(x);                                                   // Serially, no results.
+ *     p.score_all(forward_to_member::parallel(4096), x);                // In parallel.
+ *     p.score_all(forward_to_member::parallel().into(scores.begin()), x); // Results into scores.
+ *
+ * The elements can be values, pointers or anything pointer-like, as with FORWARD_TO_MEMBER_AS. The
+ * overload of the method is classified the same way, so the exposed function is const exactly when
+ * the overload is. Only const overloads may run in parallel since they are the ones that can safely
+ * run concurrently, asking for a parallel fan-out of anything else fails to compile.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_EACH_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_EACH_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "forward_to_member.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Execution policy calling the method on each element in order on the calling thread.
+ */
+struct sequential_policy { };
+
+/**
+ * Execution policy splitting the elements into chunks of grain_size elements that are handed out to
+ * up to max_threads threads, the calling thread included. A max_threads of zero uses
+ * std::thread::hardware_concurrency threads. The container and the output range, if any, must be
+ * random access.
+ */
+struct parallel_policy
+{
+    std::size_t grain_size;
+    unsigned max_threads;
+};
+
+/**
+ * Output of a fan-out whose results are discarded.
+ */
+struct discard_output { };
+
+/**
+ * Options of a fan-out, passed as the first argument of a function exposed by
+ * FORWARD_TO_EACH_MEMBER. The result of calling the method on the i-th element is assigned to the
+ * i-th position of output unless output is a discard_output.
+ */
+template<typename Policy, typename Output = discard_output>
+struct each_options
+{
+    Policy policy;
+    Output output;
+
+    /**
+     * Same options except the results are assigned to the range starting at first, which must be
+     * large enough for one result per element.
+     */
+    template<typename OutputIt>
+    each_options<Policy, OutputIt> into(OutputIt first) const
+    {
+        return each_options<Policy, OutputIt>{policy, first};
+    }
+};
+
+/**
+ * Options for a sequential fan-out, which is also what is used when no options are given.
+ */
+inline each_options<sequential_policy> sequential()
+{
+    return each_options<sequential_policy>{sequential_policy(), discard_output()};
+}
+
+/**
+ * Options for a parallel fan-out with the given grain size and maximum number of threads.
+ */
+inline each_options<parallel_policy> parallel(std::size_t grain_size = 4096,
+                                              unsigned max_threads = 0)
+{
+    return each_options<parallel_policy>{parallel_policy{grain_size, max_threads},
+                                         discard_output()};
+}
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * The type of the elements of a container member of type C.
+ */
+template<typename C>
+using each_element = typename std::remove_reference<
+    decltype(*std::begin(std::declval<typename std::remove_reference<C>::type&>()))>::type;
+
+/**
+ * True if T is a forward_to_member::each_options.
+ */
+template<typename T>
+struct is_each_options : public std::false_type { };
+
+template<typename Policy, typename Output>
+struct is_each_options<forward_to_member::each_options<Policy, Output>> : public std::true_type { };
+
+/**
+ * True if the first of TArgs is a forward_to_member::each_options, possibly cv qualified or a
+ * reference.
+ */
+template<typename... TArgs>
+struct starts_with_each_options : public std::false_type { };
+
+template<typename First, typename... TArgs>
+struct starts_with_each_options<First, TArgs...>
+    : public is_each_options<typename std::decay<First>::type> { };
+
+/**
+ * True if the function of Tag, called on an Object, has an overload whose parameters are exactly
+ * Args, whatever its qualifiers. The overloads are classified on the types of the arguments, so
+ * this tells whether classifying with Args finds the overload they call.
+ */
+template<typename Tag, typename Object, typename Void, typename... Args>
+struct each_declares : public std::false_type { };
+
+template<typename Tag, typename Signature, typename T, typename = void>
+struct each_castable : public std::false_type { };
+
+template<typename Tag, typename Signature, typename T>
+struct each_castable<Tag, Signature, T, typename std::conditional<
+                                            true, void,
+                                            decltype(Tag::template address<Signature, T>())>::type>
+    : public std::true_type { };
+
+template<typename Tag, typename Object, typename... Args>
+struct each_declares<Tag, Object,
+                     typename std::conditional<
+                         true, void,
+                         decltype(Tag::call(std::declval<Object>(),
+                                            std::declval<Args>()...))>::type,
+                     Args...>
+{
+    using R = decltype(Tag::call(std::declval<Object>(), std::declval<Args>()...));
+    using S = forward_member_signatures<Object, R, Args...>;
+    using T = typename S::T;
+
+    static constexpr bool value =
+        each_castable<Tag, R (T::*)(Args...), T>::value ||
+        each_castable<Tag, typename S::p_ref, T>::value ||
+        each_castable<Tag, typename S::c, T>::value ||
+        each_castable<Tag, typename S::c_ref, T>::value ||
+        each_castable<Tag, typename S::v, T>::value ||
+        each_castable<Tag, typename S::v_ref, T>::value ||
+        each_castable<Tag, typename S::cv, T>::value ||
+        each_castable<Tag, typename S::cv_ref, T>::value;
+};
+
+/**
+ * Traits of the overload of the function of Tag selected by the arguments TArgs, which the method
+ * is called with as lvalues since they are shared by every element. The overload is classified on
+ * the lvalues, or else on const lvalues or values of the decayed arguments if no overload takes
+ * the lvalues exactly, in the order an lvalue prefers them.
+ */
+template<typename Tag, typename Object, typename... TArgs>
+struct each_traits
+{
+    using type = typename std::conditional<
+        each_declares<Tag, Object, void, TArgs&...>::value,
+        forward_member_traits<Tag, Object, TArgs&...>,
+        typename std::conditional<
+            each_declares<Tag, Object, void, const typename std::decay<TArgs>::type&...>::value,
+            forward_member_traits<Tag, Object, const typename std::decay<TArgs>::type&...>,
+            forward_member_traits<Tag, Object, typename std::decay<TArgs>::type...>>::type>::type;
+};
+
+/**
+ * Splits the arguments of a function exposed by FORWARD_TO_EACH_MEMBER into the optional leading
+ * each_options and the arguments of the method. traits gives the each_traits of the method's
+ * arguments.
+ */
+template<typename... TArgs>
+struct each_arguments
+{
+    template<typename Tag, typename Object>
+    using traits = typename each_traits<Tag, Object, TArgs...>::type;
+};
+
+template<typename First, typename... TArgs>
+struct each_arguments<First, TArgs...>
+{
+    template<typename Tag, typename Object>
+    using traits = typename std::conditional<
+        starts_with_each_options<First>::value,
+        each_traits<Tag, Object, TArgs...>, each_traits<Tag, Object, First, TArgs...>>::type::type;
+};
+
+/**
+ * The return type of a fan-out whose method returns R into Output. The iterator past the last
+ * result is returned, or nothing when the results are discarded.
+ */
+template<typename R, typename Output>
+struct each_result
+{
+    using type = Output;
+};
+
+template<typename R>
+struct each_result<R, forward_to_member::discard_output>
+{
+    using type = void;
+};
+
+/**
+ * Calls the method on one element and stores the result into output, or discards it.
+ */
+template<typename Output, typename Call, typename E, typename... TArgs>
+void each_store(Output& output, Call& call, E& element, TArgs&... args)
+{
+    *output = call(element, args...);
+}
+
+template<typename Call, typename E, typename... TArgs>
+void each_store(forward_to_member::discard_output&, Call& call, E& element, TArgs&... args)
+{
+    call(element, args...);
+}
+
+/**
+ * Advances output by n, which does nothing when the results are discarded.
+ */
+template<typename Output>
+Output each_advance(Output output, std::size_t n)
+{
+    std::advance(output, n);
+    return output;
+}
+
+inline forward_to_member::discard_output each_advance(forward_to_member::discard_output output,
+                                                      std::size_t)
+{
+    return output;
+}
+
+/**
+ * Returns the end of the output, or nothing when the results are discarded.
+ */
+template<typename Output>
+Output each_return(Output output)
+{
+    return output;
+}
+
+inline void each_return(forward_to_member::discard_output) { }
+
+/**
+ * Sequential fan-out. Concurrent is true if the method may run concurrently, which does not matter
+ * here.
+ */
+template<bool Concurrent, typename Output, typename C, typename Call, typename... TArgs>
+auto each_run(const forward_to_member::each_options<forward_to_member::sequential_policy,
+                                                    Output>& options,
+              C& container, Call call, TArgs&... args)
+    -> typename each_result<decltype(call(*std::begin(container), args...)), Output>::type
+{
+    static_assert(!std::is_void<decltype(call(*std::begin(container), args...))>::value ||
+                  std::is_same<Output, forward_to_member::discard_output>::value,
+                  "The results of a method returning void cannot be stored.");
+    Output output = options.output;
+    for (auto& element : container)
+    {
+        each_store(output, call, element, args...);
+        output = each_advance(output, 1);
+    }
+    return each_return(output);
+}
+
+/**
+ * Parallel fan-out. Chunks of elements are handed out through an atomic counter so threads that
+ * finish early take more chunks. The first exception thrown by the method is rethrown on the
+ * calling thread once every thread has stopped, the chunks not started by then are skipped. If a
+ * thread cannot be started, the chunks are shared by the threads already started and the calling
+ * thread.
+ */
+template<bool Concurrent, typename Output, typename C, typename Call, typename... TArgs>
+auto each_run(const forward_to_member::each_options<forward_to_member::parallel_policy,
+                                                    Output>& options,
+              C& container, Call call, TArgs&... args)
+    -> typename each_result<decltype(call(*std::begin(container), args...)), Output>::type
+{
+    static_assert(Concurrent, "Only a const method can be called on each element in parallel.");
+    static_assert(!std::is_void<decltype(call(*std::begin(container), args...))>::value ||
+                  std::is_same<Output, forward_to_member::discard_output>::value,
+                  "The results of a method returning void cannot be stored.");
+
+    auto first = std::begin(container);
+    const std::size_t size = static_cast<std::size_t>(std::distance(first, std::end(container)));
+    const std::size_t grain = std::max<std::size_t>(options.policy.grain_size, 1);
+    const std::size_t chunks = (size + grain - 1) / grain;
+    std::size_t threads = options.policy.max_threads ? options.policy.max_threads
+                                                     : std::thread::hardware_concurrency();
+    threads = std::max<std::size_t>(std::min(threads, chunks), 1);
+
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto work = [&]()
+    {
+        for (std::size_t chunk = next++; chunk < chunks && !failed; chunk = next++)
+        {
+            const std::size_t begin = chunk * grain;
+            const std::size_t end = std::min(begin + grain, size);
+            try
+            {
+                Output output = each_advance(options.output, begin);
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    each_store(output, call, first[i], args...);
+                    output = each_advance(output, 1);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!failed.exchange(true))
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    try
+    {
+        for (std::size_t i = 1; i < threads; ++i)
+        {
+            pool.emplace_back(work);
+        }
+    }
+    catch (...)
+    {
+    }
+    work();
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return each_return(each_advance(options.output, size));
+}
+
+/**
+ * Runs a fan-out without options, which is sequential and discards the results.
+ */
+template<bool Concurrent, typename C, typename Call, typename... TArgs>
+auto for_each_member(C& container, Call call, TArgs&&... args)
+    -> typename std::enable_if<
+           !starts_with_each_options<TArgs...>::value,
+           decltype(each_run<Concurrent>(forward_to_member::sequential(), container, call,
+                                         args...))>::type
+{
+    return each_run<Concurrent>(forward_to_member::sequential(), container, call, args...);
+}
+
+/**
+ * Runs a fan-out with the given options.
+ */
+template<bool Concurrent, typename C, typename Call, typename Policy, typename Output,
+         typename... TArgs>
+auto for_each_member(C& container, Call call,
+                     const forward_to_member::each_options<Policy, Output>& options,
+                     TArgs&&... args)
+    -> decltype(each_run<Concurrent>(options, container, call, args...))
+{
+    return each_run<Concurrent>(options, container, call, args...);
+}
+
+} /* End namespace detail. */
+
+/**
+ * Generates code which exposes a function in some class that invokes a method on every element of
+ * one of the class's members, a container. The function takes the same arguments as the method,
+ * optionally preceded by the forward_to_member::each_options returned by
+ * forward_to_member::sequential or forward_to_member::parallel. The arguments are passed to the
+ * method as lvalues since they are shared by every element.
+ *
+ * @param c The name of the container member whose elements the function should be called on.
+ * @param f The name of the function to invoke on each element.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_EACH_MEMBER(c, f, n)                                                            \
+    using element_type_##c##_##f##_##n =                                                           \
+        detail::forward_member_underlying_type<detail::each_element<decltype(c)>>::type;           \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(c, f, n)                                                       \
+                                                                                                   \
+    /**                                                                                            \
+     * Calls f on a single element, dereferencing it if it is a pointer or pointer-like. The       \
+     * object is made const if Const is true, so that the const overload runs through pointers too.\
+     */                                                                                            \
+    template <bool Const>                                                                          \
+    struct each_call_##c##_##f##_##n                                                               \
+    {                                                                                              \
+        template <typename E, typename... TArgs>                                                   \
+        auto operator()(E& element, TArgs&... args) const                                          \
+            -> decltype(detail::forward_member_target<Const, TArgs...>(element).f(args...))        \
+        {                                                                                          \
+            return detail::forward_member_target<Const, TArgs...>(element).f(args...);             \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is neither const nor const volatile. Elements of a        \
+     * container cannot be reached through a volatile container, so volatile overloads are         \
+     * exposed as non-volatile functions.                                                          \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args)                                                                        \
+        -> typename std::enable_if<                                                                \
+               !detail::each_arguments<TArgs...>::template traits<                                 \
+                   access_##c##_##f##_##n, element_type_##c##_##f##_##n&>::has_const,              \
+               decltype(detail::for_each_member<false>(                                            \
+                   c, each_call_##c##_##f##_##n<false>(), std::forward<TArgs>(args)...))>::type    \
+    {                                                                                              \
+        return detail::for_each_member<false>(c, each_call_##c##_##f##_##n<false>(),               \
+                                              std::forward<TArgs>(args)...);                       \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is const or const volatile, and may run in parallel.      \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args) const                                                                  \
+        -> typename std::enable_if<                                                                \
+               detail::each_arguments<TArgs...>::template traits<                                  \
+                   access_##c##_##f##_##n, element_type_##c##_##f##_##n&>::has_const,              \
+               decltype(detail::for_each_member<true>(                                             \
+                   c, each_call_##c##_##f##_##n<true>(), std::forward<TArgs>(args)...))>::type     \
+    {                                                                                              \
+        return detail::for_each_member<true>(c, each_call_##c##_##f##_##n<true>(),                 \
+                                             std::forward<TArgs>(args)...);                        \
+    }
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_EACH_HPP__ */
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include "forward_to_member_each.hpp"
+
+/**
+ * Simple structure for testing containing a const function, a non-const function and a function
+ * returning nothing.
+ */
+struct worker
+{
+    int id;
+    int calls;
+    int score(int scale) const { return id * scale; }
+    int visit() { return ++calls; }
+    void reset() { calls = 0; }
+    int check(int limit) const
+    {
+        if (id >= limit)
+        {
+            throw std::runtime_error("limit reached");
+        }
+        return id;
+    }
+};
+
+/**
+ * Structure whose overloads differ only by their constness, to check which of them is called.
+ */
+struct twin
+{
+    int get() { return 1; }
+    int get() const { return 2; }
+    int take(int&& value) { return value; }
+    int take(const int& value) const { return 2 * value; }
+};
+
+/**
+ * Holds twins through pointers, whose const overload is the one called so that it can run in
+ * parallel.
+ */
+struct twins
+{
+    std::vector<twin> values;
+    std::vector<twin*> pointers;
+    FORWARD_TO_EACH_MEMBER(pointers, get, get_all);
+    FORWARD_TO_EACH_MEMBER(pointers, take, take_all);
+
+    explicit twins(int size) : values(size)
+    {
+        for (auto& t : values)
+        {
+            pointers.push_back(&t);
+        }
+    }
+};
+
+/**
+ * Holds workers by value and through pointers and forwards their functions to all of them.
+ */
+struct pool
+{
+    std::vector<worker> workers;
+    FORWARD_TO_EACH_MEMBER(workers, score, score_all);
+    FORWARD_TO_EACH_MEMBER(workers, visit, visit_all);
+    FORWARD_TO_EACH_MEMBER(workers, reset, reset_all);
+    FORWARD_TO_EACH_MEMBER(workers, check, check_all);
+
+    std::vector<std::shared_ptr<worker>> shared;
+    FORWARD_TO_EACH_MEMBER(shared, score, shared_score_all);
+
+    std::vector<worker*> pointers;
+    FORWARD_TO_EACH_MEMBER(pointers, visit, pointer_visit_all);
+
+    explicit pool(int size)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            workers.push_back(worker{i, 0});
+            shared.push_back(std::make_shared<worker>(worker{i, 0}));
+        }
+        for (auto& w : workers)
+        {
+            pointers.push_back(&w);
+        }
+    }
+};
+
+int main()
+{
+    const int size = 1000;
+    pool p(size);
+    const pool& pc = p;
+    std::vector<int> results(size, -1);
+
+    // Sequential fan-out with and without storing the results.
+    p.score_all(2);
+    assert(results.end() == p.score_all(forward_to_member::sequential().into(results.begin()), 2));
+    for (int i = 0; i < size; ++i)
+    {
+        assert(2 * i == results[i]);
+    }
+    assert(results.end() == p.visit_all(forward_to_member::sequential().into(results.begin())));
+    assert(1 == results.front() && 1 == results.back());
+    p.visit_all();
+    assert(2 == p.workers.front().calls && 2 == p.workers.back().calls);
+    p.reset_all();
+    assert(0 == p.workers.front().calls && 0 == p.workers.back().calls);
+
+    // Parallel fan-out of a const function, on a const pool too, with several grain sizes.
+    for (std::size_t grain : {1, 7, 64, 4096})
+    {
+        std::fill(results.begin(), results.end(), -1);
+        pc.score_all(forward_to_member::parallel(grain, 4).into(results.begin()), 3);
+        for (int i = 0; i < size; ++i)
+        {
+            assert(3 * i == results[i]);
+        }
+    }
+    p.score_all(forward_to_member::parallel(), 1);
+    std::fill(results.begin(), results.end(), -1);
+    p.shared_score_all(forward_to_member::parallel(16).into(results.begin()), 5);
+    assert(0 == results.front() && 5 * (size - 1) == results.back());
+
+    // Non-const functions cannot run in parallel, but can be called through pointers.
+    p.pointer_visit_all();
+    assert(1 == p.workers.front().calls && 1 == p.workers.back().calls);
+
+    // An exception thrown on any element is propagated to the caller.
+    bool thrown = false;
+    try
+    {
+        pc.check_all(forward_to_member::parallel(10, 4), 500);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    pc.check_all(forward_to_member::parallel(10, 4), 1000);
+
+    // The const overload is called through pointers, on a const holder or not, in parallel.
+    twins t(size);
+    const twins& tc = t;
+    std::fill(results.begin(), results.end(), -1);
+    t.get_all(forward_to_member::parallel(7, 4).into(results.begin()));
+    assert(std::count(results.begin(), results.end(), 2) == size);
+    std::fill(results.begin(), results.end(), -1);
+    tc.get_all(forward_to_member::parallel(7, 4).into(results.begin()));
+    assert(std::count(results.begin(), results.end(), 2) == size);
+
+    // An rvalue argument is passed to every element as an lvalue, so the overload taking an lvalue
+    // is the one classified and called, here in parallel.
+    std::fill(results.begin(), results.end(), -1);
+    tc.take_all(forward_to_member::parallel(7, 4).into(results.begin()), 3);
+    assert(std::count(results.begin(), results.end(), 6) == size);
+    std::fill(results.begin(), results.end(), -1);
+    t.take_all(forward_to_member::sequential().into(results.begin()), 3);
+    assert(std::count(results.begin(), results.end(), 6) == size);
+
+    // An empty container calls nothing.
+    pool empty(0);
+    auto end = empty.score_all(forward_to_member::parallel().into(results.begin()), 1);
+    assert(results.begin() == end);
+}
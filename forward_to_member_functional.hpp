@@ -0,0 +1,31 @@
+/**
+ * This file provides the pointer_like_traits of std::reference_wrapper, which let
+ * FORWARD_TO_MEMBER_AS reach the object behind members of that type. It is included by
+ * forward_to_member.hpp, and is only needed along with forward_to_member_core.hpp by translation
+ * units with such members.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_FUNCTIONAL_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_FUNCTIONAL_HPP__
+
+#include <functional>
+#include "forward_to_member_core.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Specialization for std::reference_wrapper. reference_wrapper<T>::get is not marked as volatile.
+ */
+template<typename T>
+struct pointer_like_traits<std::reference_wrapper<T>>
+{
+    using element_type = T;
+    static constexpr bool volatile_get = false;
+    FORWARD_TO_MEMBER_DETAIL_INLINE
+    static T& deref(const std::reference_wrapper<T>& p) noexcept { return p.get(); }
+};
+
+} /* End namespace forward_to_member. */
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_FUNCTIONAL_HPP__ */
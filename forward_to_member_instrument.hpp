@@ -0,0 +1,422 @@
+/**
+ * This file provides the run-time side of the instrumentation of forwarded functions, which is
+ * switched on by defining FORWARD_TO_MEMBER_INSTRUMENT before including forward_to_member.hpp:
+ *
+ *     g++ -DFORWARD_TO_MEMBER_INSTRUMENT ...
+ *
+ * Every call of a function exposed by FORWARD_TO_MEMBER_AS, FORWARD_TO_MEMBER_ALL and the
+ * forwarders built on them then counts itself and its latency in counters of the calling thread,
+ * one cache line aligned block of counters per forwarder and thread, so threads never write to the
+ * same cache line. The counters of all threads, including those that have exited, are merged on
+ * demand by forward_to_member::instrumentation_report:
+ *
+ *     forward_to_member::write_instrumentation_report(std::cerr);
+ *
+ *     bar::func1 -> f.func1 calls 1200 mean 3 ns p50 4 ns p99 8 ns max 16 ns
+ *
+ * Without FORWARD_TO_MEMBER_INSTRUMENT nothing is compiled in and the exposed functions are
+ * unchanged. With it they cannot be used in constant expressions.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_INSTRUMENT_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_INSTRUMENT_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace forward_to_member
+{
+
+/**
+ * Number of buckets of the latency histograms. Bucket 0 counts the calls that took less than a
+ * nanosecond and bucket i > 0 those that took [2^(i - 1), 2^i) nanoseconds, the last one also
+ * counting everything slower.
+ */
+constexpr std::size_t latency_buckets = 46;
+
+/**
+ * Merged statistics of one forwarder.
+ */
+struct forwarder_stats
+{
+    /**
+     * "Class::n -> m.f" for the function n exposed in Class forwarding to f of member m.
+     */
+    std::string name;
+    std::uint64_t calls;
+    std::uint64_t total_ns;
+    std::uint64_t histogram[latency_buckets];
+
+    /**
+     * Gets the upper bound in nanoseconds of the bucket holding the call at fraction p of the
+     * calls sorted by latency, e.g. 0.99 for the 99th percentile.
+     */
+    std::uint64_t percentile(double p) const noexcept
+    {
+        const double rank = p * static_cast<double>(calls);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < latency_buckets; ++i)
+        {
+            seen += histogram[i];
+            if (histogram[i] && static_cast<double>(seen) >= rank)
+            {
+                return std::uint64_t(1) << i;
+            }
+        }
+        return 0;
+    }
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * A forwarder, registered when it is first called.
+ */
+struct forward_member_site
+{
+    forward_member_site(const std::type_info& owner, const char* exposed, const char* member,
+                        const char* function);
+
+    const std::type_info& owner;
+    const char* exposed;
+    const char* member;
+    const char* function;
+    std::size_t index;
+};
+
+/**
+ * The counters of one forwarder on one thread, a whole number of cache lines. Only the owning
+ * thread writes them, with plain loads and stores, and the merge reads them concurrently.
+ */
+struct forward_member_counters
+{
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> total_ns;
+    std::atomic<std::uint64_t> histogram[forward_to_member::latency_buckets];
+
+    static constexpr std::size_t cache_line = 64;
+
+    forward_member_counters() noexcept : calls(0), total_ns(0)
+    {
+        for (auto& bucket : histogram)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t by) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t ns) noexcept
+    {
+        std::size_t bucket = 0;
+        for (std::uint64_t rest = ns; rest && bucket + 1 < forward_to_member::latency_buckets;
+             rest >>= 1)
+        {
+            ++bucket;
+        }
+        bump(calls, 1);
+        bump(total_ns, ns);
+        bump(histogram[bucket], 1);
+    }
+};
+
+static_assert(sizeof(forward_member_counters) % forward_member_counters::cache_line == 0,
+              "forward_member_counters must fill whole cache lines");
+
+/**
+ * Plain totals of a forwarder, used to accumulate exited threads and reset points.
+ */
+struct forward_member_totals
+{
+    std::uint64_t calls = 0;
+    std::uint64_t total_ns = 0;
+    std::uint64_t histogram[forward_to_member::latency_buckets] = {};
+
+    void add(const forward_member_counters& counters) noexcept
+    {
+        calls += counters.calls.load(std::memory_order_relaxed);
+        total_ns += counters.total_ns.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < forward_to_member::latency_buckets; ++i)
+        {
+            histogram[i] += counters.histogram[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    void add(const forward_member_totals& other) noexcept
+    {
+        calls += other.calls;
+        total_ns += other.total_ns;
+        for (std::size_t i = 0; i < forward_to_member::latency_buckets; ++i)
+        {
+            histogram[i] += other.histogram[i];
+        }
+    }
+};
+
+class forward_member_thread_counters;
+
+/**
+ * The forwarders and the threads that called them. Never destroyed, so threads exiting during
+ * static destruction can still retire their counters.
+ */
+struct forward_member_registry
+{
+    std::mutex mutex;
+    std::vector<const forward_member_site*> sites;
+    std::vector<forward_member_thread_counters*> threads;
+    std::vector<forward_member_totals> retired;
+    std::vector<forward_member_totals> baseline;
+
+    static forward_member_registry& get()
+    {
+        static forward_member_registry* registry = new forward_member_registry();
+        return *registry;
+    }
+};
+
+/**
+ * The counters of the calling thread, one block per forwarder it has called, each allocated on
+ * its own cache lines. The blocks are merged into the registry when the thread exits.
+ */
+class forward_member_thread_counters
+{
+public:
+    forward_member_thread_counters()
+    {
+        forward_member_registry& registry = forward_member_registry::get();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+
+    forward_member_thread_counters(const forward_member_thread_counters&) = delete;
+    forward_member_thread_counters& operator=(const forward_member_thread_counters&) = delete;
+
+    ~forward_member_thread_counters()
+    {
+        forward_member_registry& registry = forward_member_registry::get();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        add_to(registry.retired);
+        for (auto& thread : registry.threads)
+        {
+            if (thread == this)
+            {
+                thread = registry.threads.back();
+                registry.threads.pop_back();
+                break;
+            }
+        }
+    }
+
+    static forward_member_thread_counters& current()
+    {
+        static thread_local forward_member_thread_counters counters;
+        return counters;
+    }
+
+    forward_member_counters& at(std::size_t index)
+    {
+        if (index < slots.size() && slots[index])
+        {
+            return *slots[index];
+        }
+        return allocate(index);
+    }
+
+    /**
+     * Adds the counters to totals, indexed by forwarder. The registry mutex must be held.
+     */
+    void add_to(std::vector<forward_member_totals>& totals) const
+    {
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i])
+            {
+                if (totals.size() <= i)
+                {
+                    totals.resize(i + 1);
+                }
+                totals[i].add(*slots[i]);
+            }
+        }
+    }
+
+private:
+    forward_member_counters& allocate(std::size_t index)
+    {
+        const std::size_t line = forward_member_counters::cache_line;
+        std::unique_ptr<unsigned char[]> block(
+            new unsigned char[sizeof(forward_member_counters) + line - 1]);
+        void* aligned = block.get() + (line - reinterpret_cast<std::uintptr_t>(block.get()) % line)
+                                      % line;
+        forward_member_counters* counters = ::new (aligned) forward_member_counters();
+
+        forward_member_registry& registry = forward_member_registry::get();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        if (slots.size() <= index)
+        {
+            slots.resize(index + 1, nullptr);
+        }
+        slots[index] = counters;
+        storage.push_back(std::move(block));
+        return *counters;
+    }
+
+    std::vector<forward_member_counters*> slots;
+    std::vector<std::unique_ptr<unsigned char[]>> storage;
+};
+
+inline forward_member_site::forward_member_site(const std::type_info& owner, const char* exposed,
+                                                const char* member, const char* function)
+    : owner(owner), exposed(exposed), member(member), function(function)
+{
+    forward_member_registry& registry = forward_member_registry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    index = registry.sites.size();
+    registry.sites.push_back(this);
+}
+
+/**
+ * Times a call of a forwarder, from its construction to its destruction.
+ */
+class forward_member_probe
+{
+public:
+    explicit forward_member_probe(const forward_member_site& site) noexcept
+        : site(site), start(std::chrono::steady_clock::now()) { }
+
+    forward_member_probe(const forward_member_probe&) = delete;
+    forward_member_probe& operator=(const forward_member_probe&) = delete;
+
+    ~forward_member_probe()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        forward_member_thread_counters::current().at(site.index).record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+private:
+    const forward_member_site& site;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * Gets the readable name of a type.
+ */
+inline std::string forward_member_type_name(const std::type_info& type)
+{
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> demangled(
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), std::free);
+    if (status == 0 && demangled)
+    {
+        return demangled.get();
+    }
+#endif
+    return type.name();
+}
+
+/**
+ * Gets the totals of every forwarder: those of exited threads plus those of live threads.
+ * The registry mutex must be held.
+ */
+inline std::vector<forward_member_totals> forward_member_merge(forward_member_registry& registry)
+{
+    std::vector<forward_member_totals> totals(registry.sites.size());
+    for (std::size_t i = 0; i < registry.retired.size(); ++i)
+    {
+        totals[i].add(registry.retired[i]);
+    }
+    for (const forward_member_thread_counters* thread : registry.threads)
+    {
+        thread->add_to(totals);
+    }
+    return totals;
+}
+
+} /* End namespace detail. */
+
+namespace forward_to_member
+{
+
+/**
+ * Merges the counters of every thread into the statistics of every forwarder called since the
+ * program started or since the last reset_instrumentation, in the order they were first called.
+ */
+inline std::vector<forwarder_stats> instrumentation_report()
+{
+    detail::forward_member_registry& registry = detail::forward_member_registry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const std::vector<detail::forward_member_totals> totals =
+        detail::forward_member_merge(registry);
+    std::vector<forwarder_stats> report;
+    for (std::size_t i = 0; i < registry.sites.size(); ++i)
+    {
+        const detail::forward_member_site& site = *registry.sites[i];
+        forwarder_stats stats;
+        stats.name = detail::forward_member_type_name(site.owner) + "::" + site.exposed + " -> " +
+                     site.member + "." + site.function;
+        const bool reset = i < registry.baseline.size();
+        stats.calls = totals[i].calls - (reset ? registry.baseline[i].calls : 0);
+        stats.total_ns = totals[i].total_ns - (reset ? registry.baseline[i].total_ns : 0);
+        for (std::size_t b = 0; b < latency_buckets; ++b)
+        {
+            stats.histogram[b] = totals[i].histogram[b] - (reset ? registry.baseline[i].histogram[b]
+                                                                 : 0);
+        }
+        report.push_back(stats);
+    }
+    return report;
+}
+
+/**
+ * Starts counting again from zero. The counters themselves are only written by their threads, so
+ * this records the current totals and the report subtracts them.
+ */
+inline void reset_instrumentation()
+{
+    detail::forward_member_registry& registry = detail::forward_member_registry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.baseline = detail::forward_member_merge(registry);
+}
+
+/**
+ * Writes one line per forwarder called with its call count and latency: the mean and the upper
+ * bounds of the histogram buckets holding the median, the 99th percentile and the slowest call.
+ */
+inline void write_instrumentation_report(std::ostream& out)
+{
+    for (const forwarder_stats& stats : instrumentation_report())
+    {
+        if (stats.calls)
+        {
+            out << stats.name << " calls " << stats.calls << " mean "
+                << stats.total_ns / stats.calls << " ns p50 " << stats.percentile(0.5)
+                << " ns p99 " << stats.percentile(0.99) << " ns max " << stats.percentile(1.0)
+                << " ns\n";
+        }
+    }
+}
+
+} /* End namespace forward_to_member. */
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_INSTRUMENT_HPP__ */
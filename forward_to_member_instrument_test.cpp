@@ -0,0 +1,106 @@
+#define FORWARD_TO_MEMBER_INSTRUMENT
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "forward_to_member.hpp"
+
+/**
+ * Simple structure for testing with a const and a non-const function.
+ */
+struct engine
+{
+    int rpm;
+    int speed(int gear) const { return rpm * gear; }
+    void rev(int by) { rpm += by; }
+    void stall() { rpm = 0; }
+};
+
+/**
+ * Forwards to a value through FORWARD_TO_MEMBER_AS and to a pointer through FORWARD_TO_MEMBER_ALL.
+ */
+struct car
+{
+    engine e;
+    FORWARD_TO_MEMBER_AS(e, speed, velocity);
+    FORWARD_TO_MEMBER(e, rev);
+
+    engine* spare;
+    FORWARD_TO_MEMBER_ALL(spare, stall);
+};
+
+/**
+ * Gets the statistics of the forwarder with the given name.
+ */
+forward_to_member::forwarder_stats find(const std::string& name)
+{
+    for (const auto& stats : forward_to_member::instrumentation_report())
+    {
+        if (stats.name == name)
+        {
+            return stats;
+        }
+    }
+    assert(false);
+    return forward_to_member::forwarder_stats();
+}
+
+/**
+ * Gets the number of calls counted by a histogram.
+ */
+std::uint64_t histogram_calls(const forward_to_member::forwarder_stats& stats)
+{
+    std::uint64_t calls = 0;
+    for (std::uint64_t bucket : stats.histogram)
+    {
+        calls += bucket;
+    }
+    return calls;
+}
+
+int main()
+{
+    engine spare{100};
+    car c{engine{10}, &spare};
+    const car& cc = c;
+
+    // Calls are counted per forwarder, under the name of the class and both functions.
+    for (int i = 0; i < 3; ++i)
+    {
+        c.rev(1);
+    }
+    assert(26 == cc.velocity(2));
+    c.stall();
+    assert(0 == spare.rpm);
+    assert(3 == find("car::rev -> e.rev").calls);
+    assert(1 == find("car::velocity -> e.speed").calls);
+    assert(1 == find("car::stall -> spare.stall").calls);
+
+    // Counters of other threads are merged, including those of threads that have exited.
+    std::thread other([&c]()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            c.velocity(1);
+        }
+    });
+    other.join();
+    const auto velocity = find("car::velocity -> e.speed");
+    assert(1001 == velocity.calls);
+    assert(velocity.calls == histogram_calls(velocity));
+    assert(velocity.percentile(0.5) <= velocity.percentile(0.99));
+    assert(velocity.percentile(0.99) <= velocity.percentile(1.0));
+
+    // The report has one line per forwarder called.
+    std::ostringstream report;
+    forward_to_member::write_instrumentation_report(report);
+    assert(std::string::npos != report.str().find("car::velocity -> e.speed calls 1001 mean "));
+    assert(std::string::npos != report.str().find("car::rev -> e.rev calls 3 mean "));
+
+    // Resetting starts counting again from zero.
+    forward_to_member::reset_instrumentation();
+    assert(0 == find("car::rev -> e.rev").calls);
+    c.rev(1);
+    assert(1 == find("car::rev -> e.rev").calls);
+    assert(1 == histogram_calls(find("car::rev -> e.rev")));
+}
@@ -0,0 +1,400 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_INTERFACE macro, which declares a type-erased value type
+ * from a list of methods, as an alternative to an abstract base class:
+ *
+ *     FORWARD_TO_MEMBER_INTERFACE(shape,
+ *                                 (area, double() const),
+ *                                 (scale, void(double)));
+ *
+ *     struct circle { double r; double area() const; void scale(double k); };
+ *     struct square { double side; double area() const; void scale(double k); };
+ *
+ *     std::vector<shape> shapes;
+ *     shapes.emplace_back(circle{1});
+ *     shapes.emplace_back(square{2});
+ *     shapes[0].area();
+ *
+ * A shape holds any object with those methods. Objects small enough are stored in the shape itself
+ * and larger ones on the heap. Each type stored gets a single static table of functions forwarding
+ * to its methods, and a shape holds a pointer to it next to the object, so a call loads the
+ * function from the table and calls it on the object, without going through a pointer to the
+ * object as with a unique_ptr to a base class.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_INTERFACE_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_INTERFACE_HPP__
+
+#include <cstddef>
+#include <new>
+#include "forward_to_member.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Size of the storage of the objects held inline by a FORWARD_TO_MEMBER_INTERFACE type.
+ */
+constexpr std::size_t default_interface_size = 4 * sizeof(void*);
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * Access to an object stored inline in the storage of an interface value.
+ */
+template<typename T>
+struct forward_member_poly_inline
+{
+    static T& get(void* storage) noexcept
+    {
+        return *static_cast<T*>(storage);
+    }
+
+    static const T& get(const void* storage) noexcept
+    {
+        return *static_cast<const T*>(storage);
+    }
+
+    template<typename... Args>
+    static void create(void* storage, Args&&... args)
+    {
+        ::new (storage) T(std::forward<Args>(args)...);
+    }
+
+    static void destroy(void* storage)
+    {
+        get(storage).~T();
+    }
+
+    static void move(void* from, void* to)
+    {
+        ::new (to) T(std::move(get(from)));
+        destroy(from);
+    }
+};
+
+/**
+ * Access to an object allocated on the heap, whose pointer is stored in the storage of an interface
+ * value.
+ */
+template<typename T>
+struct forward_member_poly_heap
+{
+    static T& get(void* storage) noexcept
+    {
+        return **static_cast<T**>(storage);
+    }
+
+    static const T& get(const void* storage) noexcept
+    {
+        return **static_cast<T* const*>(storage);
+    }
+
+    template<typename... Args>
+    static void create(void* storage, Args&&... args)
+    {
+        *static_cast<T**>(storage) = new T(std::forward<Args>(args)...);
+    }
+
+    static void destroy(void* storage)
+    {
+        delete *static_cast<T**>(storage);
+    }
+
+    static void move(void* from, void* to)
+    {
+        *static_cast<T**>(to) = *static_cast<T**>(from);
+    }
+};
+
+/**
+ * Gets how an object of type T is stored in Size bytes aligned for std::max_align_t: inline if it
+ * fits and can be moved without throwing, since moving an interface value must not throw, and on
+ * the heap otherwise.
+ */
+template<typename T, std::size_t Size>
+using forward_member_poly_access = typename std::conditional<
+    sizeof(T) <= Size && alignof(std::max_align_t) % alignof(T) == 0 &&
+        std::is_nothrow_move_constructible<T>::value,
+    forward_member_poly_inline<T>, forward_member_poly_heap<T>>::type;
+
+/**
+ * The functions at the start of every table, managing the lifetime of the object stored.
+ */
+struct forward_member_poly_ops
+{
+    void (*destroy)(void* storage);
+    void (*move)(void* from, void* to);
+};
+
+/**
+ * The entry of a table for a method with signature Sig, which is a function type, const if the
+ * method is. thunk calls the method through Call::call on the object Access gets from the storage.
+ */
+template<typename Sig>
+struct forward_member_poly_method;
+
+template<typename R, typename... Args>
+struct forward_member_poly_method<R(Args...)>
+{
+    static constexpr bool is_const = false;
+    using result_type = R;
+    using pointer = R (*)(void*, Args...);
+
+    template<typename Call, typename Access>
+    static R thunk(void* storage, Args... args)
+    {
+        return Call::template call<false>(Access::get(storage), std::forward<Args>(args)...);
+    }
+};
+
+template<typename R, typename... Args>
+struct forward_member_poly_method<R(Args...) const>
+{
+    static constexpr bool is_const = true;
+    using result_type = R;
+    using pointer = R (*)(const void*, Args...);
+
+    template<typename Call, typename Access>
+    static R thunk(const void* storage, Args... args)
+    {
+        return Call::template call<true>(Access::get(storage), std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * enable_if made dependent on the arguments of an exposed function, so a method of the wrong
+ * constness only removes the candidate from overload resolution.
+ */
+template<bool B, typename R, typename... TArgs>
+struct forward_member_poly_enable : public std::enable_if<B, R> { };
+
+/**
+ * The storage of an interface value and the pointer to the table of the type of the object it
+ * holds, which starts with the forward_member_poly_ops. Manages the lifetime of the object, the
+ * generated class adding the constructors and the methods.
+ */
+template<std::size_t Size>
+class forward_member_poly
+{
+public:
+    forward_member_poly() noexcept : ops(nullptr) { }
+
+    forward_member_poly(forward_member_poly&& other) noexcept : ops(nullptr)
+    {
+        take(other);
+    }
+
+    forward_member_poly& operator=(forward_member_poly&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    forward_member_poly(const forward_member_poly&) = delete;
+    forward_member_poly& operator=(const forward_member_poly&) = delete;
+
+    ~forward_member_poly()
+    {
+        reset();
+    }
+
+    /**
+     * Destroys the object held, leaving the value empty.
+     */
+    void reset() noexcept
+    {
+        if (ops)
+        {
+            ops->destroy(&storage);
+            ops = nullptr;
+        }
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ops != nullptr;
+    }
+
+protected:
+    /**
+     * The helpers for the generated class are prefixed so they don't clash with its methods.
+     */
+    template<typename Access, typename... Args>
+    void poly_create(const forward_member_poly_ops* table, Args&&... args)
+    {
+        Access::create(&storage, std::forward<Args>(args)...);
+        ops = table;
+    }
+
+    /**
+     * Gets the table, whose first member is the forward_member_poly_ops ops points to.
+     */
+    template<typename Table>
+    const Table* poly_table() const noexcept
+    {
+        return reinterpret_cast<const Table*>(ops);
+    }
+
+    void* poly_object() noexcept
+    {
+        return &storage;
+    }
+
+    const void* poly_object() const noexcept
+    {
+        return &storage;
+    }
+
+private:
+    void take(forward_member_poly& other) noexcept
+    {
+        if (other.ops)
+        {
+            other.ops->move(&other.storage, &storage);
+            ops = other.ops;
+            other.ops = nullptr;
+        }
+    }
+
+    typename std::aligned_storage<Size < sizeof(void*) ? sizeof(void*) : Size,
+                                  alignof(std::max_align_t)>::type storage;
+    const forward_member_poly_ops* ops;
+};
+
+} /* End namespace detail. */
+
+/**
+ * Declares the entry of the table for a method given as (name, signature).
+ */
+#define FORWARD_TO_MEMBER_DETAIL_POLY_ENTRY(m, method) FORWARD_TO_MEMBER_DETAIL_POLY_ENTRY_I method
+#define FORWARD_TO_MEMBER_DETAIL_POLY_ENTRY_I(name, ...)                                           \
+    detail::forward_member_poly_method<__VA_ARGS__>::pointer name;
+
+/**
+ * Initializes the entry of the table of a type, stored as given by Access, for a method given as
+ * (name, signature).
+ */
+#define FORWARD_TO_MEMBER_DETAIL_POLY_THUNK(m, method) FORWARD_TO_MEMBER_DETAIL_POLY_THUNK_I method
+#define FORWARD_TO_MEMBER_DETAIL_POLY_THUNK_I(name, ...)                                           \
+    &detail::forward_member_poly_method<__VA_ARGS__>::template thunk<call_##name, Access>,
+
+/**
+ * Declares, for a method given as (name, signature), the struct calling it on the object stored
+ * and the method of the interface calling it through the table. The object stored may also be a
+ * pointer or pointer-like type, which the call goes through, and it is made const for const
+ * methods so the const overload is the one called even through pointers.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_POLY_METHOD(m, method) \
+    FORWARD_TO_MEMBER_DETAIL_POLY_METHOD_I method
+#define FORWARD_TO_MEMBER_DETAIL_POLY_METHOD_I(name, ...)                                          \
+    struct call_##name                                                                             \
+    {                                                                                              \
+        template <bool Const, typename T, typename... TArgs>                                       \
+        static auto call(T& object, TArgs&&... args)                                               \
+            -> decltype(detail::forward_member_target<Const, TArgs...>(object).name(               \
+                   std::forward<TArgs>(args)...))                                                  \
+        {                                                                                          \
+            return detail::forward_member_target<Const, TArgs...>(object).name(                    \
+                std::forward<TArgs>(args)...);                                                     \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+public:                                                                                            \
+    template <typename... TArgs>                                                                   \
+    auto name(TArgs&&... args) const                                                               \
+        -> typename detail::forward_member_poly_enable<                                            \
+               detail::forward_member_poly_method<__VA_ARGS__>::is_const,                          \
+               detail::forward_member_poly_method<__VA_ARGS__>::result_type, TArgs...>::type       \
+    {                                                                                              \
+        return poly_table<table_type>()->name(poly_object(), std::forward<TArgs>(args)...);    \
+    }                                                                                              \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    auto name(TArgs&&... args)                                                                     \
+        -> typename detail::forward_member_poly_enable<                                            \
+               !detail::forward_member_poly_method<__VA_ARGS__>::is_const,                         \
+               detail::forward_member_poly_method<__VA_ARGS__>::result_type, TArgs...>::type       \
+    {                                                                                              \
+        return poly_table<table_type>()->name(poly_object(), std::forward<TArgs>(args)...);    \
+    }                                                                                              \
+                                                                                                   \
+private:
+
+/**
+ * Declares a movable value type, named name, holding an object of any type having the methods
+ * given, on which it exposes them. Each method is given as (name, signature), where the signature
+ * is a function type which is const if the method is, e.g. (area, double() const). The methods
+ * can't be overloaded or be named reset. Objects of up to size bytes that can be moved without
+ * throwing are stored inline and others on the heap. The object stored can also be a pointer or
+ * pointer-like type, in which case the methods are called on the object it points to. Up to 32
+ * methods may be given.
+ *
+ * A value is empty when default constructed, moved from or reset, and calling a method of an empty
+ * value is undefined. Values can't be copied.
+ *
+ * @param name The name of the type to declare.
+ * @param size The size of the storage of the objects held inline.
+ * @param ... The methods of the type, each as (name, signature).
+ */
+#define FORWARD_TO_MEMBER_INTERFACE_SIZE(name, size, ...)                                          \
+    class name : public detail::forward_member_poly<size>                                          \
+    {                                                                                              \
+    private:                                                                                       \
+        /**                                                                                        \
+         * The functions of the table of a type, one per method.                                   \
+         */                                                                                        \
+        struct table_type                                                                          \
+        {                                                                                          \
+            detail::forward_member_poly_ops ops;                                                   \
+            FORWARD_TO_MEMBER_DETAIL_FOR_EACH(FORWARD_TO_MEMBER_DETAIL_POLY_ENTRY, name,           \
+                                              __VA_ARGS__)                                         \
+        };                                                                                         \
+                                                                                                   \
+        FORWARD_TO_MEMBER_DETAIL_FOR_EACH(FORWARD_TO_MEMBER_DETAIL_POLY_METHOD, name, __VA_ARGS__) \
+                                                                                                   \
+        /**                                                                                        \
+         * Gets the table of the type stored as given by Access, which is constant initialized.    \
+         */                                                                                        \
+        template <typename Access>                                                                 \
+        static const detail::forward_member_poly_ops* table_for() noexcept                         \
+        {                                                                                          \
+            static const table_type table = {                                                      \
+                {&Access::destroy, &Access::move},                                                 \
+                FORWARD_TO_MEMBER_DETAIL_FOR_EACH(FORWARD_TO_MEMBER_DETAIL_POLY_THUNK, name,       \
+                                                  __VA_ARGS__)                                     \
+            };                                                                                     \
+            return &table.ops;                                                                     \
+        }                                                                                          \
+                                                                                                   \
+    public:                                                                                        \
+        name() noexcept = default;                                                                 \
+        name(name&&) noexcept = default;                                                           \
+        name& operator=(name&&) noexcept = default;                                                \
+                                                                                                   \
+        /**                                                                                        \
+         * Holds a copy of object, or object itself moved, stored inline if it fits.               \
+         */                                                                                        \
+        template <typename T,                                                                      \
+                  typename = typename std::enable_if<                                              \
+                      !std::is_same<typename std::decay<T>::type, name>::value>::type>             \
+        name(T&& object)                                                                           \
+        {                                                                                          \
+            using access = detail::forward_member_poly_access<typename std::decay<T>::type, size>; \
+            poly_create<access>(table_for<access>(), std::forward<T>(object));                     \
+        }                                                                                          \
+    }
+
+/**
+ * Same as FORWARD_TO_MEMBER_INTERFACE_SIZE with forward_to_member::default_interface_size.
+ */
+#define FORWARD_TO_MEMBER_INTERFACE(name, ...)                                                     \
+    FORWARD_TO_MEMBER_INTERFACE_SIZE(name, forward_to_member::default_interface_size, __VA_ARGS__)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_INTERFACE_HPP__ */
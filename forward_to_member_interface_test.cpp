@@ -0,0 +1,189 @@
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "forward_to_member_interface.hpp"
+#include "test_allocation_counter.hpp"
+
+FORWARD_TO_MEMBER_INTERFACE(shape,
+                            (area, double() const),
+                            (scale, void(double)),
+                            (name, std::string() const),
+                            (resize, double(double, double)));
+
+/**
+ * Number of shapes alive, to check that every object stored is destroyed exactly once.
+ */
+static int alive = 0;
+
+/**
+ * Small shape, stored inline, with const and non-const overloads of area to check that the const
+ * one is called through const methods.
+ */
+struct circle
+{
+    double r;
+
+    explicit circle(double r) : r(r) { ++alive; }
+    circle(const circle& other) noexcept : r(other.r) { ++alive; }
+    ~circle() { --alive; }
+
+    double area() const { return 3 * r * r; }
+    double area() { return -1; }
+    void scale(double k) { r *= k; }
+    std::string name() const { return "circle"; }
+    double resize(double a, double b) { r = a + b; return r; }
+};
+
+/**
+ * Large shape, stored on the heap.
+ */
+struct polygon
+{
+    double sides[16];
+    std::size_t count;
+
+    polygon() : count(0) { ++alive; }
+    polygon(const polygon& other) : count(other.count)
+    {
+        ++alive;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sides[i] = other.sides[i];
+        }
+    }
+    ~polygon() { --alive; }
+
+    double area() const
+    {
+        double a = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            a += sides[i];
+        }
+        return a;
+    }
+    void scale(double k)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sides[i] *= k;
+        }
+    }
+    std::string name() const { return "polygon"; }
+    double resize(double a, double) { return a; }
+};
+
+/**
+ * Move-only shape whose move constructor may throw, so it is stored on the heap even though it is
+ * small.
+ */
+struct blob
+{
+    std::unique_ptr<double> size;
+
+    explicit blob(double size) : size(new double(size)) { }
+    blob(blob&& other) : size(std::move(other.size)) { }
+
+    double area() const { return *size; }
+    void scale(double k) { *size *= k; }
+    std::string name() const { return "blob"; }
+    double resize(double a, double b) { return *size = a * b; }
+};
+
+/**
+ * Shape throwing when copied.
+ */
+struct broken
+{
+    broken() = default;
+    broken(const broken&) { throw std::runtime_error("copy"); }
+
+    double area() const { return 0; }
+    void scale(double) { }
+    std::string name() const { return "broken"; }
+    double resize(double, double) { return 0; }
+};
+
+int main()
+{
+    {
+        // Small objects are stored inline and large ones on the heap.
+        long before = allocations;
+        shape c = circle(1);
+        assert(before == allocations);
+        polygon p;
+        p.count = 2;
+        p.sides[0] = 1;
+        p.sides[1] = 2;
+        shape big = p;
+        assert(before + 1 == allocations);
+
+        // Methods are called on the object stored, const methods on the const object.
+        assert(3 == c.area() && 3 == big.area());
+        c.scale(2);
+        big.scale(2);
+        assert(12 == c.area() && 6 == big.area());
+        const shape& cc = c;
+        assert(12 == cc.area() && "circle" == cc.name() && "polygon" == big.name());
+        assert(5 == c.resize(2, 3) && 75 == c.area());
+        assert(3 == p.area());
+
+        // Moving transfers the object and leaves the source empty, without allocating.
+        before = allocations;
+        shape moved = std::move(c);
+        shape moved_big = std::move(big);
+        assert(before == allocations);
+        assert(!c && !big && moved && moved_big);
+        assert(75 == moved.area() && 6 == moved_big.area());
+        moved = std::move(moved_big);
+        assert(6 == moved.area() && !moved_big);
+
+        // Move-only objects and objects with a throwing move constructor are stored on the heap.
+        before = allocations;
+        shape b = blob(2);
+        assert(before + 2 == allocations);
+        assert(4 == b.resize(2, 2) && 4 == b.area() && "blob" == b.name());
+
+        // Pointer and pointer-like objects are reached through the pointer.
+        circle target(1);
+        shape pointer = &target;
+        pointer.scale(3);
+        assert(3 == target.r && 27 == pointer.area());
+        shape shared = std::make_shared<circle>(2);
+        assert(12 == shared.area());
+
+        // Values can be stored in containers and called in turn.
+        std::vector<shape> shapes;
+        shapes.emplace_back(circle(1));
+        shapes.emplace_back(p);
+        shapes.emplace_back(blob(5));
+        double total = 0;
+        for (const shape& s : shapes)
+        {
+            total += s.area();
+        }
+        assert(11 == total);
+
+        // A value whose object fails to be constructed stays empty.
+        shape failed;
+        bool thrown = false;
+        try
+        {
+            failed = shape(broken());
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown && !failed);
+
+        moved.reset();
+        assert(!moved);
+    }
+
+    // Every object stored has been destroyed.
+    assert(0 == alive);
+}
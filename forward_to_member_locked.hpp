@@ -0,0 +1,310 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_LOCKED macro, a variant of FORWARD_TO_MEMBER_AS whose
+ * exposed function holds a lock on a mutex for the duration of the call. The lock is shared when
+ * the overload selected is const and exclusive otherwise, so readers of a member guarded by a
+ * reader-writer mutex don't serialize:
+ *
+ *     class registry
+ *     {
+ *     private:
+ *         mutable std::shared_mutex mutex;
+ *         std::map<std::string, int> entries;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_LOCKED(entries, find, find, mutex);     // Shared lock.
+ *         FORWARD_TO_MEMBER_LOCKED(entries, emplace, emplace, mutex);  // Exclusive lock.
+ *     };
+ *
+ * The mutex can be any type, how it is locked being given by forward_to_member::lock_traits.
+ * Types with lock_shared are locked shared for const overloads and types without it, such as
+ * std::mutex, are always locked exclusively. forward_to_member::spinlock,
+ * forward_to_member::shared_spinlock and forward_to_member::null_mutex (no locking at all) are
+ * provided as alternatives to the standard mutexes.
+ *
+ * The lock is released when the call returns, so references returned by the method are not
+ * protected by it.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_LOCKED_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_LOCKED_HPP__
+
+#include <atomic>
+#include "forward_to_member.hpp"
+#include "forward_to_member_spin.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * How FORWARD_TO_MEMBER_LOCKED locks a Mutex. This is the general case, for mutexes without
+ * lock_shared, which are locked exclusively even for const overloads. Specialize it to use another
+ * type of mutex.
+ */
+template<typename Mutex, typename = void>
+struct lock_traits
+{
+    static void lock(Mutex& mutex) { mutex.lock(); }
+    static void unlock(Mutex& mutex) noexcept { mutex.unlock(); }
+    static void lock_shared(Mutex& mutex) { mutex.lock(); }
+    static void unlock_shared(Mutex& mutex) noexcept { mutex.unlock(); }
+};
+
+/**
+ * Specialization for reader-writer mutexes, i.e. those with lock_shared such as std::shared_mutex.
+ */
+template<typename Mutex>
+struct lock_traits<Mutex, typename std::conditional<
+                              true, void, decltype(std::declval<Mutex&>().lock_shared())>::type>
+{
+    static void lock(Mutex& mutex) { mutex.lock(); }
+    static void unlock(Mutex& mutex) noexcept { mutex.unlock(); }
+    static void lock_shared(Mutex& mutex) { mutex.lock_shared(); }
+    static void unlock_shared(Mutex& mutex) noexcept { mutex.unlock_shared(); }
+};
+
+/**
+ * Mutex that doesn't lock, for members that only need synchronization in some configurations.
+ */
+struct null_mutex
+{
+    void lock() noexcept { }
+    bool try_lock() noexcept { return true; }
+    void unlock() noexcept { }
+    void lock_shared() noexcept { }
+    bool try_lock_shared() noexcept { return true; }
+    void unlock_shared() noexcept { }
+};
+
+/**
+ * Exclusive spinlock, for members whose methods are short enough that sleeping on a contended
+ * std::mutex costs more than spinning.
+ */
+class spinlock
+{
+public:
+    spinlock() noexcept : locked(false) { }
+    spinlock(const spinlock&) = delete;
+    spinlock& operator=(const spinlock&) = delete;
+
+    void lock() noexcept
+    {
+        unsigned spins = 0;
+        while (locked.exchange(true, std::memory_order_acquire))
+        {
+            while (locked.load(std::memory_order_relaxed))
+            {
+                detail::spin_wait(spins);
+            }
+        }
+    }
+
+    bool try_lock() noexcept
+    {
+        return !locked.load(std::memory_order_relaxed) &&
+               !locked.exchange(true, std::memory_order_acquire);
+    }
+
+    void unlock() noexcept
+    {
+        locked.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> locked;
+};
+
+/**
+ * Reader-writer spinlock. A writer waiting for the lock keeps new readers out, so a steady stream
+ * of readers cannot starve it.
+ */
+class shared_spinlock
+{
+public:
+    shared_spinlock() noexcept : state(0) { }
+    shared_spinlock(const shared_spinlock&) = delete;
+    shared_spinlock& operator=(const shared_spinlock&) = delete;
+
+    void lock() noexcept
+    {
+        unsigned spins = 0;
+        unsigned expected = state.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (!(expected & (writer | waiting)))
+            {
+                if (state.compare_exchange_weak(expected, expected | waiting,
+                                                std::memory_order_relaxed))
+                {
+                    break;
+                }
+                continue;
+            }
+            detail::spin_wait(spins);
+            expected = state.load(std::memory_order_relaxed);
+        }
+        expected = waiting;
+        while (!state.compare_exchange_weak(expected, writer, std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+        {
+            detail::spin_wait(spins);
+            expected = waiting;
+        }
+    }
+
+    bool try_lock() noexcept
+    {
+        unsigned expected = 0;
+        return state.compare_exchange_strong(expected, writer, std::memory_order_acquire,
+                                             std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept
+    {
+        state.store(0, std::memory_order_release);
+    }
+
+    void lock_shared() noexcept
+    {
+        unsigned spins = 0;
+        while (!try_lock_shared())
+        {
+            detail::spin_wait(spins);
+        }
+    }
+
+    bool try_lock_shared() noexcept
+    {
+        unsigned expected = state.load(std::memory_order_relaxed);
+        return !(expected & (writer | waiting)) &&
+               state.compare_exchange_weak(expected, expected + reader, std::memory_order_acquire,
+                                           std::memory_order_relaxed);
+    }
+
+    void unlock_shared() noexcept
+    {
+        state.fetch_sub(reader, std::memory_order_release);
+    }
+
+private:
+    /**
+     * The state holds the number of readers above two bits telling whether a writer holds the lock
+     * and whether one is waiting for the readers to leave.
+     */
+    static constexpr unsigned writer = 1;
+    static constexpr unsigned waiting = 2;
+    static constexpr unsigned reader = 4;
+
+    std::atomic<unsigned> state;
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * Holds a shared or exclusive lock on a mutex until destroyed.
+ */
+template<typename Mutex, bool Shared>
+class forward_member_lock
+{
+public:
+    explicit forward_member_lock(Mutex& mutex) : mutex(&mutex)
+    {
+        if (Shared)
+        {
+            forward_to_member::lock_traits<Mutex>::lock_shared(mutex);
+        }
+        else
+        {
+            forward_to_member::lock_traits<Mutex>::lock(mutex);
+        }
+    }
+
+    forward_member_lock(forward_member_lock&& other) noexcept : mutex(other.mutex)
+    {
+        other.mutex = nullptr;
+    }
+
+    forward_member_lock(const forward_member_lock&) = delete;
+    forward_member_lock& operator=(const forward_member_lock&) = delete;
+
+    ~forward_member_lock()
+    {
+        if (mutex && Shared)
+        {
+            forward_to_member::lock_traits<Mutex>::unlock_shared(*mutex);
+        }
+        else if (mutex)
+        {
+            forward_to_member::lock_traits<Mutex>::unlock(*mutex);
+        }
+    }
+
+private:
+    Mutex* mutex;
+};
+
+/**
+ * Locks mutex, which is used without the volatile qualification it gets in volatile exposed
+ * functions since mutexes are synchronized on their own.
+ */
+template<bool Shared, typename Mutex>
+forward_member_lock<Mutex, Shared> forward_member_make_lock(volatile Mutex& mutex)
+{
+    return forward_member_lock<Mutex, Shared>(const_cast<Mutex&>(mutex));
+}
+
+} /* End namespace detail. */
+
+/**
+ * Call macro for FORWARD_TO_MEMBER_DETAIL_EXPOSE taking the lock for the duration of the call. The
+ * lock is a temporary of the full expression, so it is released once the result is constructed.
+ * The member is made const if the function is, so the const overload that a shared lock was taken
+ * for is the one called, even through pointers.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_CALL_LOCKED(m, f, n, object, forwarded_args)                      \
+    ((void)lock_##m##_##f##_##n<FORWARD_TO_MEMBER_DETAIL_LOCKED_SHARED(m, f, n, object)>(),        \
+     detail::forward_member_target<FORWARD_TO_MEMBER_DETAIL_LOCKED_SHARED(m, f, n, object),        \
+                                   TArgs...>(object).f(forwarded_args))
+
+/**
+ * True if the overload of f called on object is const, and the lock can be shared.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_LOCKED_SHARED(m, f, n, object)                                    \
+    function_traits_##m##_##f##_##n<                                                               \
+        detail::forward_member_object<decltype(detail::forward_member_deref<TArgs...>(object)),    \
+                                      member_type_##m##_##f##_##n>, TArgs...>::has_const
+
+/**
+ * Generates code which exposes a function in some class that invokes a method (potentially having
+ * several overloads) on one of the class's members while holding a lock on a mutex. The member and
+ * the exposed functions are the same as with FORWARD_TO_MEMBER_AS. The lock is shared if the
+ * overload called is const and exclusive otherwise, as given by forward_to_member::lock_traits.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ * @param mutex An lvalue expression, evaluated in the exposed function, for the mutex to lock. A
+ *              mutex member must be declared before the macro and mutable to be locked by const
+ *              exposed functions.
+ */
+#define FORWARD_TO_MEMBER_LOCKED(m, f, n, mutex)                                                   \
+    using member_type_##m##_##f##_##n = detail::forward_member_underlying_type<decltype(m)>::type; \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    /**                                                                                            \
+     * Locks the mutex, shared if Shared is true.                                                  \
+     */                                                                                            \
+    template <bool Shared>                                                                         \
+    auto lock_##m##_##f##_##n() const volatile                                                     \
+        -> decltype(detail::forward_member_make_lock<Shared>(mutex))                               \
+    {                                                                                              \
+        return detail::forward_member_make_lock<Shared>(mutex);                                    \
+    }                                                                                              \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE(m, f, n, member_type_##m##_##f##_##n,                          \
+                                    FORWARD_TO_MEMBER_DETAIL_CALL_LOCKED)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_LOCKED_HPP__ */
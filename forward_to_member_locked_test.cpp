@@ -0,0 +1,169 @@
+#include <cassert>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <shared_mutex>
+#endif
+#include "forward_to_member_locked.hpp"
+
+/**
+ * Reader-writer mutex recording how it is held, so the forwarded functions can check it.
+ */
+struct recording_mutex
+{
+    int exclusive = 0;
+    int shared = 0;
+    int locks = 0;
+    void lock() { assert(!exclusive && !shared); ++exclusive; ++locks; }
+    void unlock() { --exclusive; }
+    void lock_shared() { assert(!exclusive); ++shared; ++locks; }
+    void unlock_shared() { --shared; }
+};
+
+/**
+ * Simple structure for testing with const and non-const overloads checking the lock they are
+ * called under.
+ */
+struct table
+{
+    const recording_mutex* mutex;
+    int value;
+    int get() const { assert(1 == mutex->shared && !mutex->exclusive); return value; }
+    int get(int scale) { assert(mutex->exclusive && !mutex->shared); return value * scale; }
+    void set(int v) { assert(mutex->exclusive); value = v; }
+    int peek() const { assert(mutex->shared); return 1; }
+    int peek() { return 2; }
+    int fail() const { throw std::runtime_error("failed"); }
+    int touch() volatile { return 4; }
+    int inspect() const volatile { return 5; }
+};
+
+/**
+ * Forwards to a table held by value and through a pointer under a recording mutex.
+ */
+struct guarded_table
+{
+    mutable recording_mutex mutex;
+    table t;
+    FORWARD_TO_MEMBER_LOCKED(t, get, get, mutex);
+    FORWARD_TO_MEMBER_LOCKED(t, set, set, mutex);
+    FORWARD_TO_MEMBER_LOCKED(t, fail, fail, mutex);
+    FORWARD_TO_MEMBER_LOCKED(t, touch, touch, mutex);
+    FORWARD_TO_MEMBER_LOCKED(t, inspect, inspect, mutex);
+
+    table* p;
+    FORWARD_TO_MEMBER_LOCKED(p, peek, peek, mutex);
+
+    guarded_table() : t{&mutex, 0}, p(&t) { }
+};
+
+struct counter
+{
+    long count = 0;
+    void increment() { ++count; }
+    long read() const { return count; }
+};
+
+/**
+ * Forwards to a counter under a mutex of the given type.
+ */
+#define GUARDED_COUNTER(name, mutex_type)                                                          \
+    struct name                                                                                    \
+    {                                                                                              \
+        mutable mutex_type mutex;                                                                  \
+        counter c;                                                                                 \
+        FORWARD_TO_MEMBER_LOCKED(c, increment, increment, mutex);                                  \
+        FORWARD_TO_MEMBER_LOCKED(c, read, read, mutex);                                            \
+    }
+
+GUARDED_COUNTER(mutex_counter, std::mutex);
+GUARDED_COUNTER(spinlock_counter, forward_to_member::spinlock);
+GUARDED_COUNTER(shared_spinlock_counter, forward_to_member::shared_spinlock);
+GUARDED_COUNTER(null_mutex_counter, forward_to_member::null_mutex);
+#if __cplusplus >= 201703L
+GUARDED_COUNTER(shared_mutex_counter, std::shared_mutex);
+#endif
+
+/**
+ * Increments a guarded counter from several threads while others read it.
+ */
+template<typename Guarded>
+void hammer()
+{
+    Guarded g;
+    const int threads = 4;
+    const int increments = 10000;
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&g, i]()
+        {
+            long last = 0;
+            for (int j = 0; j < increments; ++j)
+            {
+                if (i % 2)
+                {
+                    long current = static_cast<const Guarded&>(g).read();
+                    assert(current >= last);
+                    last = current;
+                }
+                else
+                {
+                    g.increment();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    assert(threads / 2 * increments == g.read());
+}
+
+int main()
+{
+    // Const overloads are called under a shared lock and the others under an exclusive one.
+    guarded_table g;
+    const guarded_table& gc = g;
+    g.set(3);
+    assert(3 == gc.get());
+    assert(6 == g.get(2));
+    assert(3 == g.mutex.locks && !g.mutex.exclusive && !g.mutex.shared);
+
+    // Volatile functions can be called on volatile objects.
+    volatile guarded_table& gv = g;
+    assert(4 == gv.touch());
+    assert(5 == gv.inspect());
+    assert(!g.mutex.exclusive && !g.mutex.shared);
+
+    // The const overload the shared lock is taken for is the one called through a pointer.
+    assert(1 == g.peek());
+
+    // The lock is released when the function throws.
+    bool thrown = false;
+    try
+    {
+        gc.fail();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown && !g.mutex.shared);
+
+    // Every lock policy serializes writers.
+    hammer<mutex_counter>();
+    hammer<spinlock_counter>();
+    hammer<shared_spinlock_counter>();
+#if __cplusplus >= 201703L
+    hammer<shared_mutex_counter>();
+#endif
+
+    // The null mutex doesn't lock.
+    null_mutex_counter unlocked;
+    unlocked.increment();
+    assert(1 == unlocked.read());
+}
@@ -0,0 +1,655 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER macros without the templates they expand to calls of,
+ * which come from forward_to_member_core.hpp or, in a translation unit importing the
+ * forward_to_member module, from the module (see forward_to_member.cppm):
+ *
+ *     #include <type_traits>
+ *     #include <utility>
+ *     import forward_to_member;
+ *     #include "forward_to_member_macros.hpp"
+ *
+ * Macros are not exported by named modules, hence this file. It includes only <type_traits> and
+ * <utility>, whose templates the expansions use, and forward_to_member_config.hpp, unless
+ * FORWARD_TO_MEMBER_INSTRUMENT is defined.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_MACROS_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_MACROS_HPP__
+
+#include <type_traits>
+#include <utility>
+#include "forward_to_member_config.hpp"
+
+/**
+ * Instrumentation of the exposed functions, compiled in only if FORWARD_TO_MEMBER_INSTRUMENT is
+ * defined (see forward_to_member_instrument.hpp). INSTRUMENT_SITE declares the function registering
+ * the forwarder when it is first called and INSTRUMENT prefixes the call with a comma expression
+ * timing it, the probe being a temporary of the full expression.
+ */
+#if defined(FORWARD_TO_MEMBER_INSTRUMENT)
+#include "forward_to_member_instrument.hpp"
+#define FORWARD_TO_MEMBER_DETAIL_INSTRUMENT_SITE(m, f, n)                                          \
+    static const detail::forward_member_site& instrument_site_##m##_##f##_##n(                     \
+        const std::type_info& owner)                                                               \
+    {                                                                                              \
+        static const detail::forward_member_site site(owner, #n, #m, #f);                          \
+        return site;                                                                               \
+    }
+#define FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                               \
+    (void)detail::forward_member_probe(instrument_site_##m##_##f##_##n(typeid(                     \
+        typename std::remove_cv<typename std::remove_pointer<decltype(this)>::type>::type))),
+#else
+#define FORWARD_TO_MEMBER_DETAIL_INSTRUMENT_SITE(m, f, n)
+#define FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)
+#endif
+
+/**
+ * Declares access_##m##_##f##_##n, the method-access tag through which the templates of namespace
+ * detail, shared by every forwarded function, classify the overloads of f (see
+ * detail::forward_member_traits), and function_traits_##m##_##f##_##n, the traits classifying
+ * which overload of f a set of arguments selects. Shared by FORWARD_TO_MEMBER_AS,
+ * FORWARD_TO_MEMBER_ALL and the macros built on them.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                   \
+    /**                                                                                            \
+     * Method-access tag for f, which is all that is generated per forwarded function to classify  \
+     * its overloads. Its functions are only declared, they are used in unevaluated operands.      \
+     */                                                                                            \
+    struct access_##m##_##f##_##n                                                                  \
+    {                                                                                              \
+        template <typename Signature, typename T>                                                  \
+        static auto address() -> decltype(static_cast<Signature>(&T::f));                          \
+                                                                                                   \
+        template <typename T, typename... TArgs>                                                   \
+        static auto call(T&& object, TArgs&&... args)                                              \
+            -> decltype(std::forward<T>(object).f(std::forward<TArgs>(args)...));                  \
+    };                                                                                             \
+                                                                                                   \
+    /**                                                                                            \
+     * Traits of the overload of f selected by TArgs. T is a reference to the underlying type of   \
+     * the member whose value category is the one the function is called with.                     \
+     */                                                                                            \
+    template <typename T, typename... TArgs>                                                       \
+    using function_traits_##m##_##f##_##n =                                                        \
+        detail::forward_member_traits<access_##m##_##f##_##n, T, TArgs...>;
+
+/**
+ * Declares the candidates for the exposed function n, each enabled for one class of overload of f
+ * and noexcept exactly when the call is. Shared by FORWARD_TO_MEMBER_AS and FORWARD_TO_MEMBER_ALL.
+ * Every candidate comes in an & and a && version. The && version is selected on rvalues and calls
+ * f on the member as an rvalue if the member is owned, so a && overload of f can be selected.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ * @param member_type The underlying type of m, used to classify the overloads of f.
+ * @param call Macro taking (m, f, n, object, forwarded_args) that expands to the call on the member
+ *             given as object.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_EXPOSE(m, f, n, member_type, call)                                \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_AT(m, f, n, member_type, call, decltype(m), m)
+
+/**
+ * Same as FORWARD_TO_MEMBER_DETAIL_EXPOSE for a member reached by an expression rather than named
+ * by m, which then only names the generated declarations. Used by FORWARD_TO_MEMBER_PATH.
+ *
+ * @param member_decl The type of the member, whose traits tell whether it is owned and can be
+ *                    reached through a volatile object.
+ * @param member The expression for the member, which may use the TArgs of the candidates.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_EXPOSE_AT(m, f, n, member_type, call, member_decl, member)        \
+    FORWARD_TO_MEMBER_DETAIL_INSTRUMENT_SITE(m, f, n)                                              \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_REF(m, f, n, member_type, call, &,                             \
+                                        detail::forward_member_lvalue, member_decl, member)        \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_REF(m, f, n, member_type, call, &&,                            \
+                                        detail::forward_member_rvalue, member_decl,                \
+                                        detail::forward_member_move<member_decl>(member))
+
+/**
+ * Declares the candidates of FORWARD_TO_MEMBER_DETAIL_EXPOSE for one ref-qualifier. The arguments
+ * are forwarded with static_cast rather than std::forward, which is a call of its own in a build
+ * without optimization.
+ *
+ * @param ref The ref-qualifier of the candidates.
+ * @param object_type Alias template giving the type of object from member_decl and member_type,
+ *                    used to classify the overloads of f.
+ * @param member_decl The type of the member, decltype(m) unless it is reached by an expression.
+ * @param object The expression for the member f is called on.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_EXPOSE_REF(m, f, n, member_type, call, ref, object_type,          \
+                                            member_decl, object)                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is neither const nor volatile.                            \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE FORWARD_TO_MEMBER_DETAIL_CONSTEXPR                             \
+    auto n(TArgs&&... args) ref                                                                    \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_plain,                     \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is volatile and the member that the function is being     \
+     * invoked on can be reached through a volatile object. If the member is a pointer-like type   \
+     * without a volatile deref, such as shared_ptr, then the function we expose can't be volatile \
+     * because shared_ptr<T>::get is not marked as volatile.                                       \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE FORWARD_TO_MEMBER_DETAIL_CONSTEXPR                             \
+    auto n(TArgs&&... args) volatile ref                                                           \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               detail::is_volatile_accessible<member_decl>::value &&                               \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_volatile,                  \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is volatile and the member that the function is being     \
+     * invoked on is a pointer-like type without a volatile deref, such as shared_ptr. In this     \
+     * case the function cannot be marked as volatile because shared_ptr<T>::get is not marked as  \
+     * volatile.                                                                                   \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE FORWARD_TO_MEMBER_DETAIL_CONSTEXPR                             \
+    auto n(TArgs&&... args) ref                                                                    \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               !detail::is_volatile_accessible<member_decl>::value &&                              \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_volatile,                  \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is const and not volatile. In this case we can mark the   \
+     * function as const since it should be able to be invoked on a const object.                  \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE constexpr                                                      \
+    auto n(TArgs&&... args) const ref                                                              \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_const,                     \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is const volatile and the member that the function is     \
+     * being invoked on can be reached through a volatile object. If the member is a pointer-like  \
+     * type without a volatile deref, such as shared_ptr, then the function we expose can't be     \
+     * volatile because shared_ptr<T>::get is not marked as volatile.                              \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE constexpr                                                      \
+    auto n(TArgs&&... args) const volatile ref                                                     \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               detail::is_volatile_accessible<member_decl>::value &&                               \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_cv,                        \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Candidate for the function that actually gets exposed. This function will be selected if    \
+     * the member function being invoked is const volatile and the member that the function is     \
+     * being invoked on is a pointer-like type without a volatile deref, such as shared_ptr. In    \
+     * this case the function cannot be marked as volatile because shared_ptr<T>::get is not       \
+     * marked as volatile. The function can still be marked as const.                              \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE constexpr                                                      \
+    auto n(TArgs&&... args) const ref                                                              \
+        noexcept(noexcept(call(m, f, n, object, static_cast<TArgs&&>(args)...)))                   \
+        -> typename std::enable_if<                                                                \
+               !detail::is_volatile_accessible<member_decl>::value &&                              \
+               function_traits_##m##_##f##_##n<                                                    \
+                   object_type<member_decl, member_type>, TArgs...>::is_cv,                        \
+               decltype(call(m, f, n, object, static_cast<TArgs&&>(args)...))>::type               \
+    {                                                                                              \
+        return FORWARD_TO_MEMBER_DETAIL_INSTRUMENT(m, f, n)                                        \
+               call(m, f, n, object, static_cast<TArgs&&>(args)...);                               \
+    }
+
+/**
+ * Call macro for FORWARD_TO_MEMBER_DETAIL_EXPOSE, which calls f directly in the exposed function.
+ * FORWARD_TO_MEMBER_AS and FORWARD_TO_MEMBER_ALL get the object to call it on with
+ * detail::forward_member_target, made const if the overload selected is. It depends only on the
+ * type of the member, so it is shared by every function forwarding to members of the same type, in
+ * any class. It expands inside a candidate and uses its TArgs to keep the call dependent.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_CALL_INVOKE(m, f, n, object, forwarded_args)                      \
+    detail::forward_member_target<                                                                 \
+        function_traits_##m##_##f##_##n<                                                           \
+            detail::forward_member_object<decltype((object)), member_type_##m##_##f##_##n>,        \
+            TArgs...>::has_const,                                                                  \
+        TArgs...>(object).f(forwarded_args)
+
+/**
+ * Call macro for FORWARD_TO_MEMBER_DETAIL_EXPOSE_AT used by FORWARD_TO_MEMBER_PATH, whose object is
+ * the one at the end of the path, already dereferenced and with the cv qualification of the whole
+ * path. It is made const if the overload selected is, even if it was reached through a pointer-like
+ * member.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_CALL_PATH(m, f, n, object, forwarded_args)                        \
+    detail::forward_member_as_const<                                                               \
+        function_traits_##m##_##f##_##n<                                                           \
+            detail::forward_member_object<decltype((object)), member_type_##m##_##f##_##n>,        \
+            TArgs...>::has_const>(object).f(forwarded_args)
+
+/**
+ * Generates code which exposes a function in some class that invokes a method (potentially having
+ * several overloads) on one of the class's members. The member can be a value, reference, pointer,
+ * or pointer-like type (shared_ptr, unique_ptr, reference_wrapper or anything else with a
+ * specialization of forward_to_member::pointer_like_traits) with any combination of constness and
+ * volatileness. The exposed function will inherit the constness and volatileness of the member's
+ * function so it can be correctly invoked on const or volatile objects when needed. It is also
+ * noexcept exactly when the call on the member is, and constexpr so a constexpr function of a value
+ * or reference member can be called in constant expressions (only through const objects before
+ * C++14).
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_AS(m, f, n)                                                              \
+    using member_type_##m##_##f##_##n = detail::forward_member_underlying_type<decltype(m)>::type; \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE(m, f, n, member_type_##m##_##f##_##n,                          \
+                                    FORWARD_TO_MEMBER_DETAIL_CALL_INVOKE)
+
+/**
+ * Same as FORWARD_TO_MEMBER_AS except the name of the exposed function is the same as the name of
+ * the function being invoked on the member.
+ */
+#define FORWARD_TO_MEMBER(m, f) \
+    FORWARD_TO_MEMBER_AS(m, f, f)
+
+/**
+ * Generates the same code as FORWARD_TO_MEMBER for each of several functions of one member, so
+ *
+ *     FORWARD_TO_MEMBER_ALL(f, open, read, write, close);
+ *
+ * exposes open, read, write and close. The underlying type of the member is computed once for all
+ * of them. Up to 32 functions may be given and FORWARD_TO_MEMBER_ALL may be used only once per
+ * member.
+ *
+ * @param m The name of the member variable on which the functions should be called.
+ * @param ... The names of the functions to invoke on the member variable, which are also the names
+ *            of the functions exposed in the class.
+ */
+#define FORWARD_TO_MEMBER_ALL(m, ...)                                                              \
+    using member_type_##m = detail::forward_member_underlying_type<decltype(m)>::type;             \
+    FORWARD_TO_MEMBER_DETAIL_FOR_EACH(FORWARD_TO_MEMBER_DETAIL_ALL_ONE, m, __VA_ARGS__)
+
+/**
+ * Forwards a single function for FORWARD_TO_MEMBER_ALL.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_ALL_ONE(m, f)                                                     \
+    using member_type_##m##_##f##_##f = member_type_##m;                                           \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, f)                                                       \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE(m, f, f, member_type_##m, FORWARD_TO_MEMBER_DETAIL_CALL_INVOKE)
+
+/**
+ * Generates the same code as FORWARD_TO_MEMBER_AS for a function of the object at the end of a path
+ * of members, each a member of the object the one before it is or points to, so
+ *
+ *     FORWARD_TO_MEMBER_PATH((session, conn, socket), send, send);
+ *
+ * exposes send calling session->conn.socket->send, in a single expression rather than through a
+ * function exposed at each level as stacked FORWARD_TO_MEMBER wrappers would. Every member of the
+ * path can be a value, reference, pointer or pointer-like type. The cv qualification is computed
+ * over the whole path: a const or volatile object makes every object reached from it const or
+ * volatile, through pointers as well as values, so a non-const function can't be called through a
+ * pointer to a const object anywhere along the path. The object at the end of the path is called
+ * as an rvalue only if every member is owned, and volatile functions are exposed as volatile only
+ * if every member can be reached through a volatile object. A path has from 2 to 8 members.
+ *
+ * @param path The parenthesized names of the members, the first being a member variable of the
+ *             class and each of the others a member of the object the one before is or points to.
+ * @param f The name of the function to invoke on the object at the end of the path.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_PATH(path, f, n)                                                         \
+    FORWARD_TO_MEMBER_DETAIL_PATH(FORWARD_TO_MEMBER_DETAIL_PATH_ID path, path, f, n)
+
+/**
+ * Expands id, the members of the path pasted together, before FORWARD_TO_MEMBER_DETAIL_PATH_I
+ * names the generated declarations with it.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_PATH(id, path, f, n)                                              \
+    FORWARD_TO_MEMBER_DETAIL_PATH_I(id, path, f, n)
+
+#define FORWARD_TO_MEMBER_DETAIL_PATH_I(id, path, f, n)                                            \
+    using path_type_##id##_##f##_##n = detail::forward_member_path<                                \
+        FORWARD_TO_MEMBER_DETAIL_PATH_TYPES(detail::forward_member_hop<>, path)>;                  \
+    using member_type_##id##_##f##_##n = detail::forward_member_underlying_type<decltype(          \
+        FORWARD_TO_MEMBER_DETAIL_PATH_TO(detail::forward_member_hop<>, path))>::type;              \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(id, f, n)                                                      \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_AT(                                                            \
+        id, f, n, member_type_##id##_##f##_##n, FORWARD_TO_MEMBER_DETAIL_CALL_PATH,                \
+        path_type_##id##_##f##_##n,                                                                \
+        detail::forward_member_hop<TArgs...>(                                                      \
+            FORWARD_TO_MEMBER_DETAIL_PATH_TO(detail::forward_member_hop<TArgs...>, path)))
+
+/**
+ * Generates accessors exposing a data member of the object a member is or points to, by reference
+ * rather than by value, so that large fields are not copied:
+ *
+ *     FORWARD_TO_MEMBER_FIELD(impl, stats, stats);
+ *
+ * exposes stats(), which returns a const reference to impl->stats on a const object and a
+ * reference on a non-const lvalue. On an rvalue it returns the field moved out by value if the
+ * member is owned (held by value), and a reference otherwise, since the object being an rvalue says
+ * nothing about the object behind a reference, pointer or pointer-like member. The field of a
+ * member pointing to a const object is always const. Array fields are returned by rvalue reference
+ * rather than by value, and bit-fields can't be exposed. Volatile objects are not supported.
+ *
+ * @param m The name of the member variable whose data member is exposed.
+ * @param field The name of the data member of the object m is or points to.
+ * @param n The name of the accessor to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_FIELD(m, field, n)                                                       \
+    using field_type_##m##_##field##_##n = typename std::remove_reference<                         \
+        decltype((detail::forward_member_deref<>(m).field))>::type;                                \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE constexpr                                                      \
+    const field_type_##m##_##field##_##n& n() const & noexcept                                     \
+    {                                                                                              \
+        return detail::forward_member_deref<>(m).field;                                            \
+    }                                                                                              \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE FORWARD_TO_MEMBER_DETAIL_CONSTEXPR                             \
+    field_type_##m##_##field##_##n& n() & noexcept                                                 \
+    {                                                                                              \
+        return detail::forward_member_deref<>(m).field;                                            \
+    }                                                                                              \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE                                                                \
+    typename detail::forward_member_field<decltype(m), field_type_##m##_##field##_##n>::rvalue     \
+    n() && noexcept(                                                                               \
+        detail::forward_member_field<decltype(m), field_type_##m##_##field##_##n>::nothrow_rvalue) \
+    {                                                                                              \
+        return detail::forward_member_deref<>(detail::forward_member_move<decltype(m)>(m)).field;  \
+    }
+
+/**
+ * Declares an & or && pair of functions n calling f on the object behind the member: a const one
+ * calling it on a const object and a non-const one calling it on a non-const object, so both of a
+ * const and a non-const overload of f are exposed, as the iteration protocol needs. The overloads
+ * of f are not classified, so n and f need not be identifiers and f is reached with the constness
+ * of the object whatever the kind of member, like FORWARD_TO_MEMBER_FIELD. Shared by
+ * FORWARD_TO_MEMBER_OPERATOR and FORWARD_TO_MEMBER_RANGE.
+ *
+ * @param ref The ref-qualifier of the functions.
+ * @param object The expression for the member f is called on.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIR(f, n, ref, object)                                    \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE FORWARD_TO_MEMBER_DETAIL_CONSTEXPR                             \
+    auto n(TArgs&&... args) ref                                                                    \
+        noexcept(noexcept(detail::forward_member_deref<TArgs...>(object).f(                        \
+            static_cast<TArgs&&>(args)...)))                                                       \
+        -> decltype(detail::forward_member_deref<TArgs...>(object).f(                              \
+               static_cast<TArgs&&>(args)...))                                                     \
+    {                                                                                              \
+        return detail::forward_member_deref<TArgs...>(object).f(static_cast<TArgs&&>(args)...);    \
+    }                                                                                              \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_INLINE constexpr                                                      \
+    auto n(TArgs&&... args) const ref                                                              \
+        noexcept(noexcept(detail::forward_member_target<true, TArgs...>(object).f(                 \
+            static_cast<TArgs&&>(args)...)))                                                       \
+        -> decltype(detail::forward_member_target<true, TArgs...>(object).f(                       \
+               static_cast<TArgs&&>(args)...))                                                     \
+    {                                                                                              \
+        return detail::forward_member_target<true, TArgs...>(object).f(                            \
+            static_cast<TArgs&&>(args)...);                                                        \
+    }
+
+/**
+ * Declares the & and && pairs of FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIR. The && pair calls f on the
+ * member as an rvalue if the member is owned, as FORWARD_TO_MEMBER_DETAIL_EXPOSE does.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, f, n)                                             \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIR(f, n, &, m)                                               \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIR(f, n, &&, detail::forward_member_move<decltype(m)>(m))
+
+/**
+ * Exposes an operator of the object a member is or points to, which FORWARD_TO_MEMBER can't since
+ * the name of an operator is not an identifier. The operator is given by its symbol:
+ *
+ *     FORWARD_TO_MEMBER_OPERATOR(items, []);
+ *     FORWARD_TO_MEMBER_OPERATOR(filter, ());
+ *
+ * exposes operator[] calling items[i] and operator() calling filter(args...). Any operator the
+ * object declares as a member function can be exposed, with all of its overloads: a const object
+ * calls the const ones and a non-const object the others, whatever the kind of member, so a const
+ * overload is called through a pointer member of a const object. Volatile objects are not
+ * supported. As with FORWARD_TO_MEMBER the exposed operator is noexcept exactly when the call is,
+ * and it calls the operator on an rvalue if the object is one and the member is owned.
+ *
+ * @param m The name of the member variable on which the operator should be called.
+ * @param op The symbol of the operator, such as [] or ().
+ */
+#define FORWARD_TO_MEMBER_OPERATOR(m, op)                                                          \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, operator op, operator op)
+
+/**
+ * Exposes the iteration protocol of the range a member is or points to, begin, end, cbegin, cend,
+ * data and size, the same way FORWARD_TO_MEMBER_OPERATOR exposes an operator, so that range-based
+ * for loops and standard algorithms run over the class directly:
+ *
+ *     FORWARD_TO_MEMBER_RANGE(samples);
+ *     ...
+ *     for (double sample : recording) { ... }
+ *
+ * Iterating over a const object gives const iterators. A function the range lacks, such as data
+ * for std::list, is simply not callable.
+ *
+ * @param m The name of the member variable whose range is exposed.
+ */
+#define FORWARD_TO_MEMBER_RANGE(m)                                                                 \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, begin, begin)                                         \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, end, end)                                             \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, cbegin, cbegin)                                       \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, cend, cend)                                           \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, data, data)                                           \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE_PAIRS(m, size, size)
+
+/**
+ * Counts the arguments of a variadic macro, up to 32.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_COUNT(...)                                                        \
+    FORWARD_TO_MEMBER_DETAIL_COUNT_I(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,      \
+                                     21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,   \
+                                     5, 4, 3, 2, 1, )
+#define FORWARD_TO_MEMBER_DETAIL_COUNT_I(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12,        \
+    _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30,      \
+    _31, _32, count, ...) count
+
+/**
+ * Pastes two tokens after expanding them.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_CAT(a, b) FORWARD_TO_MEMBER_DETAIL_CAT_I(a, b)
+#define FORWARD_TO_MEMBER_DETAIL_CAT_I(a, b) a##b
+
+/**
+ * The helpers of FORWARD_TO_MEMBER_PATH, each taking the members of a path:
+ * PATH_ID pastes them into one identifier, PATH_TO expands to the expression for the last one,
+ * going through hop (detail::forward_member_hop with its template arguments) for each of the
+ * others, and PATH_TYPES to the declared types of all of them. PATH_TO and PATH_TYPES take the
+ * members parenthesized.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID(...)                                                      \
+    FORWARD_TO_MEMBER_DETAIL_CAT(FORWARD_TO_MEMBER_DETAIL_PATH_ID_,                                \
+                                 FORWARD_TO_MEMBER_DETAIL_COUNT(__VA_ARGS__))(__VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_2(a, b) a##_##b
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_3(a, b, c) a##_##b##_##c
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_4(a, b, c, d) a##_##b##_##c##_##d
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_5(a, b, c, d, e) a##_##b##_##c##_##d##_##e
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_6(a, b, c, d, e, f) a##_##b##_##c##_##d##_##e##_##f
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_7(a, b, c, d, e, f, g) \
+    a##_##b##_##c##_##d##_##e##_##f##_##g
+#define FORWARD_TO_MEMBER_DETAIL_PATH_ID_8(a, b, c, d, e, f, g, h) \
+    a##_##b##_##c##_##d##_##e##_##f##_##g##_##h
+
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO(hop, path) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TO_I(hop, FORWARD_TO_MEMBER_DETAIL_UNPACK path)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_I(hop, ...)                                               \
+    FORWARD_TO_MEMBER_DETAIL_CAT(FORWARD_TO_MEMBER_DETAIL_PATH_TO_,                                \
+                                 FORWARD_TO_MEMBER_DETAIL_COUNT(__VA_ARGS__))(hop, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_1(hop, a) a
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_2(hop, a, b) hop(a).b
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_3(hop, a, b, c) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_2(hop, a, b)).c
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_4(hop, a, b, c, d) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_3(hop, a, b, c)).d
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_5(hop, a, b, c, d, e) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_4(hop, a, b, c, d)).e
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_6(hop, a, b, c, d, e, f) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_5(hop, a, b, c, d, e)).f
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_7(hop, a, b, c, d, e, f, g) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_6(hop, a, b, c, d, e, f)).g
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TO_8(hop, a, b, c, d, e, f, g, h) \
+    hop(FORWARD_TO_MEMBER_DETAIL_PATH_TO_7(hop, a, b, c, d, e, f, g)).h
+
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES(hop, path) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_I(hop, FORWARD_TO_MEMBER_DETAIL_UNPACK path)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_I(hop, ...)                                            \
+    FORWARD_TO_MEMBER_DETAIL_CAT(FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_,                             \
+                                 FORWARD_TO_MEMBER_DETAIL_COUNT(__VA_ARGS__))(hop, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_1(hop, a) decltype(a)
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_2(hop, a, b) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_1(hop, a), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_2(hop, a, b))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_3(hop, a, b, c) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_2(hop, a, b), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_3(hop, a, b, c))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_4(hop, a, b, c, d) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_3(hop, a, b, c), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_4(hop, a, b, c, d))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_5(hop, a, b, c, d, e) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_4(hop, a, b, c, d), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_5(hop, a, b, c, d, e))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_6(hop, a, b, c, d, e, f) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_5(hop, a, b, c, d, e), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_6(hop, a, b, c, d, e, f))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_7(hop, a, b, c, d, e, f, g) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_6(hop, a, b, c, d, e, f), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_7(hop, a, b, c, d, e, f, g))
+#define FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_8(hop, a, b, c, d, e, f, g, h) \
+    FORWARD_TO_MEMBER_DETAIL_PATH_TYPES_7(hop, a, b, c, d, e, f, g), \
+    decltype(FORWARD_TO_MEMBER_DETAIL_PATH_TO_8(hop, a, b, c, d, e, f, g, h))
+
+/**
+ * Removes the parentheses around a list of macro arguments.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_UNPACK(...) __VA_ARGS__
+
+/**
+ * Expands to macro(m, x) for each x in the variadic arguments.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH(macro, m, ...)                                           \
+    FORWARD_TO_MEMBER_DETAIL_CAT(FORWARD_TO_MEMBER_DETAIL_FOR_EACH_,                               \
+                                 FORWARD_TO_MEMBER_DETAIL_COUNT(__VA_ARGS__))(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_1(macro, m, x) macro(m, x)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_2(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_1(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_3(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_2(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_4(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_3(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_5(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_4(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_6(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_5(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_7(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_6(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_8(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_7(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_9(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_8(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_10(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_9(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_11(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_10(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_12(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_11(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_13(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_12(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_14(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_13(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_15(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_14(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_16(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_15(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_17(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_16(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_18(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_17(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_19(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_18(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_20(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_19(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_21(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_20(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_22(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_21(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_23(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_22(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_24(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_23(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_25(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_24(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_26(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_25(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_27(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_26(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_28(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_27(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_29(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_28(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_30(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_29(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_31(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_30(macro, m, __VA_ARGS__)
+#define FORWARD_TO_MEMBER_DETAIL_FOR_EACH_32(macro, m, x, ...) \
+    macro(m, x) FORWARD_TO_MEMBER_DETAIL_FOR_EACH_31(macro, m, __VA_ARGS__)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_MACROS_HPP__ */
@@ -0,0 +1,382 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_MEMO macro, which exposes a const function that caches
+ * the results of a const method of a member, keyed on the arguments it is called with:
+ *
+ *     class terrain
+ *     {
+ *     public:
+ *         double elevation(int x, int y) const;    // Expensive.
+ *     };
+ *
+ *     class world
+ *     {
+ *     private:
+ *         terrain t;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_MEMO(t, elevation, elevation);
+ *     };
+ *
+ *     w.elevation(3, 4);           // Calls t.elevation(3, 4).
+ *     w.elevation(3, 4);           // Returns the cached result.
+ *     w.invalidate_elevation();    // Forgets every result, e.g. once t has changed.
+ *
+ * The cache is a fixed-capacity open-addressing hash table in the class, so it never allocates
+ * beyond what copying the arguments and the result does. Once the slots an argument tuple may go
+ * in are all taken, one of them is evicted.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_MEMO_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_MEMO_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <tuple>
+#include "forward_to_member.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Number of results FORWARD_TO_MEMBER_MEMO caches.
+ */
+constexpr std::size_t default_memo_capacity = 64;
+
+/**
+ * Counters of a cache of FORWARD_TO_MEMBER_MEMO. Invalidating the cache empties it but keeps the
+ * counters.
+ */
+struct memo_stats
+{
+    std::size_t hits;
+    std::size_t misses;
+    std::size_t evictions;
+    std::size_t size;
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * Gets the result type and the key type of the cache of results of the member function whose
+ * pointer type is F, and classifies it with the function traits generated for it.
+ */
+template<typename F>
+struct forward_member_memo_signature;
+
+#define FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(qualifiers)                                        \
+    template<typename C, typename R, typename... Args>                                             \
+    struct forward_member_memo_signature<R (C::*)(Args...) qualifiers>                             \
+    {                                                                                              \
+        using key_type = std::tuple<typename std::decay<Args>::type...>;                           \
+        using value_type = typename std::decay<R>::type;                                           \
+                                                                                                   \
+        template<template<typename, typename...> class Traits, typename T>                         \
+        using traits = Traits<T, Args...>;                                                         \
+    };
+
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE()
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(volatile)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const volatile)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(&)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const &)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(volatile &)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const volatile &)
+#if __cplusplus >= 201703L
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(volatile noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const volatile noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(& noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const & noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(volatile & noexcept)
+FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE(const volatile & noexcept)
+#endif
+
+#undef FORWARD_TO_MEMBER_DETAIL_MEMO_SIGNATURE
+
+/**
+ * Hashes the first I elements of a key by combining the std::hash of each.
+ */
+template<std::size_t I>
+struct forward_member_memo_hash
+{
+    template<typename Key>
+    static std::size_t hash(const Key& key)
+    {
+        using element = typename std::tuple_element<I - 1, Key>::type;
+        const std::size_t seed = forward_member_memo_hash<I - 1>::hash(key);
+        const std::size_t h = std::hash<element>()(std::get<I - 1>(key));
+        return seed ^ (h + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) +
+                       (seed >> 2));
+    }
+};
+
+template<>
+struct forward_member_memo_hash<0>
+{
+    template<typename Key>
+    static std::size_t hash(const Key&)
+    {
+        return 0;
+    }
+};
+
+/**
+ * Fixed-capacity cache of the results of a function, keyed on its arguments. It is an open
+ * addressing hash table with linear probing in which a key may only be stored in the window of
+ * slots following the one its hash selects. Lookups scan the whole window, which keeps them correct
+ * when a slot in the middle is emptied, and a key whose window is full replaces one of the keys in
+ * it, taken in turn. Copies start empty and assigning empties the cache, since the member the
+ * results were computed from is assigned along with it.
+ */
+template<typename Key, typename Value, std::size_t Capacity>
+class forward_member_memo
+{
+    static_assert(Capacity && !(Capacity & (Capacity - 1)),
+                  "The capacity of a memo cache must be a power of two");
+
+public:
+    forward_member_memo() noexcept : count(0), victim(0), hits(0), misses(0), evictions(0)
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+        {
+            used[i] = false;
+        }
+    }
+
+    forward_member_memo(const forward_member_memo&) noexcept : forward_member_memo() { }
+
+    forward_member_memo& operator=(const forward_member_memo&) noexcept
+    {
+        clear();
+        return *this;
+    }
+
+    ~forward_member_memo()
+    {
+        clear();
+    }
+
+    /**
+     * Gets the result cached for key, or caches and returns compute() if there is none. compute
+     * may use the cache itself, e.g. for a recursive function. Nothing is cached if it throws.
+     */
+    template<typename Compute>
+    Value get(Key&& key, Compute&& compute)
+    {
+        const std::size_t hash = forward_member_memo_hash<std::tuple_size<Key>::value>::hash(key);
+        const std::size_t found = find(hash, key);
+        if (found != Capacity)
+        {
+            ++hits;
+            return slots()[found].value;
+        }
+        ++misses;
+        Value value = compute();
+        insert(hash, std::move(key), value);
+        return value;
+    }
+
+    /**
+     * Removes the result cached for key. Returns whether there was one.
+     */
+    bool forget(const Key& key)
+    {
+        const std::size_t found =
+            find(forward_member_memo_hash<std::tuple_size<Key>::value>::hash(key), key);
+        if (found == Capacity)
+        {
+            return false;
+        }
+        destroy(found);
+        return true;
+    }
+
+    void clear() noexcept
+    {
+        for (std::size_t i = 0; count && i < Capacity; ++i)
+        {
+            if (used[i])
+            {
+                destroy(i);
+            }
+        }
+    }
+
+    forward_to_member::memo_stats stats() const noexcept
+    {
+        return forward_to_member::memo_stats{hits, misses, evictions, count};
+    }
+
+private:
+    struct slot
+    {
+        Key key;
+        Value value;
+    };
+
+    /**
+     * Number of slots a key may be stored in.
+     */
+    static constexpr std::size_t window = Capacity < 8 ? Capacity : 8;
+
+    /**
+     * Gets the slot holding key, or Capacity.
+     */
+    std::size_t find(std::size_t hash, const Key& key) const
+    {
+        for (std::size_t i = 0; i < window; ++i)
+        {
+            const std::size_t s = (hash + i) & (Capacity - 1);
+            if (used[s] && hashes[s] == hash && slots()[s].key == key)
+            {
+                return s;
+            }
+        }
+        return Capacity;
+    }
+
+    /**
+     * Caches value for key in the first empty slot of its window, or in place of one of the keys in
+     * the window if it is full. The window is scanned again since computing the value may have used
+     * the cache, which may even hold key now.
+     */
+    void insert(std::size_t hash, Key&& key, const Value& value)
+    {
+        std::size_t target = Capacity;
+        for (std::size_t i = 0; i < window; ++i)
+        {
+            const std::size_t s = (hash + i) & (Capacity - 1);
+            if (!used[s])
+            {
+                target = target == Capacity ? s : target;
+            }
+            else if (hashes[s] == hash && slots()[s].key == key)
+            {
+                return;
+            }
+        }
+        if (target == Capacity)
+        {
+            target = (hash + victim++ % window) & (Capacity - 1);
+            destroy(target);
+            ++evictions;
+        }
+        ::new (static_cast<void*>(slots() + target)) slot{std::move(key), value};
+        hashes[target] = hash;
+        used[target] = true;
+        ++count;
+    }
+
+    void destroy(std::size_t s) noexcept
+    {
+        slots()[s].~slot();
+        used[s] = false;
+        --count;
+    }
+
+    slot* slots() noexcept
+    {
+        return reinterpret_cast<slot*>(&storage);
+    }
+
+    const slot* slots() const noexcept
+    {
+        return reinterpret_cast<const slot*>(&storage);
+    }
+
+    typename std::aligned_storage<sizeof(slot) * Capacity, alignof(slot)>::type storage;
+    std::size_t hashes[Capacity];
+    bool used[Capacity];
+    std::size_t count;
+    std::size_t victim;
+    std::size_t hits;
+    std::size_t misses;
+    std::size_t evictions;
+};
+
+} /* End namespace detail. */
+
+/**
+ * Generates code which exposes a const function in some class that calls a const method of one of
+ * the class's members and caches its results, keyed on the arguments, along with invalidate_##n to
+ * forget cached results and memo_stats_##n to get the counters of the cache. The member can be a
+ * value, reference, pointer or pointer-like type. The method must not be overloaded and must be
+ * classified as const by the function traits, which the exposed function checks. It should
+ * depend on nothing but its arguments and the member, and invalidate_##n must be called whenever
+ * the member changes. The arguments are stored as a std::tuple of the decayed parameter types,
+ * which need std::hash and ==. The exposed function returns the decayed result by value. The cache
+ * is a mutable member of the class and is not synchronized, so the class must not be used from
+ * several threads at once, even through const functions.
+ *
+ * @param m The name of the member variable on which the function should be called.
+ * @param f The name of the const function to invoke on the member variable.
+ * @param n The name of the function to expose in the class.
+ * @param capacity The number of results cached, a power of two.
+ */
+#define FORWARD_TO_MEMBER_MEMO_CAPACITY(m, f, n, capacity)                                         \
+    using member_type_##m##_##f##_##n = detail::forward_member_underlying_type<decltype(m)>::type; \
+    using memo_signature_##m##_##f##_##n =                                                         \
+        detail::forward_member_memo_signature<decltype(&member_type_##m##_##f##_##n::f)>;          \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    mutable detail::forward_member_memo<memo_signature_##m##_##f##_##n::key_type,                  \
+                                        memo_signature_##m##_##f##_##n::value_type, capacity>      \
+        memo_##n;                                                                                  \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args) const                                                                  \
+        -> typename std::enable_if<                                                                \
+               std::is_constructible<memo_signature_##m##_##f##_##n::key_type, TArgs&...>::value,  \
+               memo_signature_##m##_##f##_##n::value_type>::type                                   \
+    {                                                                                              \
+        using traits_##m##_##f##_##n = memo_signature_##m##_##f##_##n::traits<                     \
+            function_traits_##m##_##f##_##n, member_type_##m##_##f##_##n&>;                        \
+        static_assert(traits_##m##_##f##_##n::has_const,                                           \
+                      "FORWARD_TO_MEMBER_MEMO requires a const member function");                  \
+                                                                                                   \
+        return memo_##n.get(memo_signature_##m##_##f##_##n::key_type{args...}, [&]()               \
+        {                                                                                          \
+            return detail::forward_member_target<true, TArgs...>(m).f(                             \
+                std::forward<TArgs>(args)...);                                                     \
+        });                                                                                        \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Forgets every cached result.                                                                \
+     */                                                                                            \
+    void invalidate_##n() const noexcept                                                           \
+    {                                                                                              \
+        memo_##n.clear();                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    /**                                                                                            \
+     * Forgets the result cached for the arguments, returning whether there was one.               \
+     */                                                                                            \
+    template <typename... TArgs>                                                                   \
+    auto invalidate_##n(TArgs&&... args) const                                                     \
+        -> typename std::enable_if<                                                                \
+               std::is_constructible<memo_signature_##m##_##f##_##n::key_type, TArgs&...>::value,  \
+               bool>::type                                                                         \
+    {                                                                                              \
+        return memo_##n.forget(memo_signature_##m##_##f##_##n::key_type{args...});                 \
+    }                                                                                              \
+                                                                                                   \
+    forward_to_member::memo_stats memo_stats_##n() const noexcept                                  \
+    {                                                                                              \
+        return memo_##n.stats();                                                                   \
+    }
+
+/**
+ * Same as FORWARD_TO_MEMBER_MEMO_CAPACITY with forward_to_member::default_memo_capacity.
+ */
+#define FORWARD_TO_MEMBER_MEMO(m, f, n)                                                            \
+    FORWARD_TO_MEMBER_MEMO_CAPACITY(m, f, n, forward_to_member::default_memo_capacity)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_MEMO_HPP__ */
@@ -0,0 +1,177 @@
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "forward_to_member_memo.hpp"
+
+/**
+ * Simple structure for testing with const methods counting how many times they are computed.
+ */
+struct terrain
+{
+    mutable int computed = 0;
+    std::string name = "hills";
+
+    long elevation(int x, int y) const
+    {
+        ++computed;
+        return x * 100L + y;
+    }
+
+    std::string label(const std::string& prefix) const
+    {
+        ++computed;
+        return prefix + name;
+    }
+
+    const std::string& title() const
+    {
+        ++computed;
+        return name;
+    }
+
+    int checked(int x) const
+    {
+        ++computed;
+        if (x < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+        return x;
+    }
+
+    int volatile_square(int x) const volatile { return x * x; }
+};
+
+/**
+ * Forwards to a terrain held by value, through a pointer and through a shared_ptr.
+ */
+struct world
+{
+    terrain t;
+    FORWARD_TO_MEMBER_MEMO(t, elevation, elevation);
+    FORWARD_TO_MEMBER_MEMO(t, label, label);
+    FORWARD_TO_MEMBER_MEMO(t, title, title);
+    FORWARD_TO_MEMBER_MEMO(t, checked, checked);
+    FORWARD_TO_MEMBER_MEMO(t, volatile_square, square);
+    FORWARD_TO_MEMBER_MEMO_CAPACITY(t, elevation, small_elevation, 4);
+
+    terrain* remote;
+    FORWARD_TO_MEMBER_MEMO(remote, elevation, remote_elevation);
+
+    std::shared_ptr<terrain> shared;
+    FORWARD_TO_MEMBER_MEMO(shared, elevation, shared_elevation);
+
+    explicit world(terrain* remote) : remote(remote), shared(std::make_shared<terrain>()) { }
+};
+
+struct fibonacci;
+
+/**
+ * Computes Fibonacci numbers through the memoized function of its owner, so each is computed once.
+ */
+struct fibonacci_source
+{
+    const fibonacci* owner;
+    long long get(long long i) const;
+};
+
+struct fibonacci
+{
+    fibonacci_source source;
+    FORWARD_TO_MEMBER_MEMO_CAPACITY(source, get, get, 128);
+
+    fibonacci() : source{this} { }
+};
+
+long long fibonacci_source::get(long long i) const
+{
+    return i < 2 ? i : owner->get(i - 1) + owner->get(i - 2);
+}
+
+int main()
+{
+    terrain remote;
+    world w(&remote);
+    const world& cw = w;
+
+    // The first call computes the result and the later ones return it from the cache.
+    assert(302 == cw.elevation(3, 2));
+    assert(302 == cw.elevation(3, 2));
+    assert(1 == w.t.computed);
+    assert(403 == cw.elevation(4, 3));
+    assert(2 == w.t.computed);
+    forward_to_member::memo_stats stats = w.memo_stats_elevation();
+    assert(1 == stats.hits && 2 == stats.misses && 0 == stats.evictions && 2 == stats.size);
+
+    // Arguments are converted to the parameter types, so they hit the same results.
+    const std::string prefix = "green ";
+    assert("green hills" == w.label("green "));
+    assert("green hills" == w.label(prefix));
+    assert(3 == w.t.computed && 1 == w.memo_stats_label().hits);
+
+    // Results are cached by value, even for methods returning references.
+    assert("hills" == w.title());
+    w.t.name = "dunes";
+    assert("hills" == w.title() && 4 == w.t.computed);
+
+    // Invalidating forgets the results computed from the old state of the member.
+    w.invalidate_title();
+    assert("dunes" == w.title() && 5 == w.t.computed);
+    w.invalidate_label();
+    assert("green dunes" == w.label(prefix) && 6 == w.t.computed);
+    assert(1 == w.memo_stats_label().hits && 1 == w.memo_stats_label().size);
+
+    // A single result can be forgotten too.
+    assert(w.invalidate_elevation(3, 2));
+    assert(!w.invalidate_elevation(3, 2));
+    assert(1 == w.memo_stats_elevation().size);
+    assert(302 == w.elevation(3, 2) && 7 == w.t.computed);
+    assert(403 == w.elevation(4, 3) && 7 == w.t.computed);
+
+    // Nothing is cached when the method throws.
+    bool thrown = false;
+    try
+    {
+        w.checked(-1);
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    assert(thrown && 0 == w.memo_stats_checked().size);
+    assert(1 == w.checked(1) && 1 == w.checked(1) && 1 == w.memo_stats_checked().hits);
+
+    // const volatile methods are const too.
+    assert(16 == w.square(4) && 16 == w.square(4) && 1 == w.memo_stats_square().hits);
+
+    // The cache is bounded and evicts older results, which are computed again.
+    const int computed = w.t.computed;
+    for (int i = 0; i < 100; ++i)
+    {
+        assert(i * 100L + i == w.small_elevation(i, i));
+    }
+    stats = w.memo_stats_small_elevation();
+    assert(4 == stats.size && 96 == stats.evictions && 100 == stats.misses);
+    assert(9999 == w.small_elevation(99, 99) && 1 == w.memo_stats_small_elevation().hits);
+    assert(computed + 100 == w.t.computed);
+    assert(0 == w.small_elevation(0, 0) && computed + 101 == w.t.computed);
+
+    // Pointer and pointer-like members are reached through the pointer.
+    assert(102 == w.remote_elevation(1, 2) && 102 == w.remote_elevation(1, 2));
+    assert(1 == remote.computed);
+    assert(102 == w.shared_elevation(1, 2) && 102 == w.shared_elevation(1, 2));
+    assert(1 == w.shared->computed);
+
+    // A copy starts with an empty cache and assigning empties it.
+    world copy = w;
+    assert(0 == copy.memo_stats_elevation().size && 2 == w.memo_stats_elevation().size);
+    assert(302 == copy.elevation(3, 2) && 1 == copy.memo_stats_elevation().size);
+    copy = w;
+    assert(0 == copy.memo_stats_elevation().size);
+
+    // A method may call the memoized function recursively.
+    fibonacci fib;
+    assert(12586269025LL == fib.get(50));
+    assert(51 == fib.memo_stats_get().misses && 48 == fib.memo_stats_get().hits);
+}
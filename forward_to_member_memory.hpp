@@ -0,0 +1,43 @@
+/**
+ * This file provides the pointer_like_traits of std::shared_ptr and std::unique_ptr, which let
+ * FORWARD_TO_MEMBER_AS reach the object behind members of those types. It is included by
+ * forward_to_member.hpp, and is only needed along with forward_to_member_core.hpp by translation
+ * units with such members.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_MEMORY_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_MEMORY_HPP__
+
+#include <memory>
+#include "forward_to_member_core.hpp"
+
+namespace forward_to_member
+{
+
+/**
+ * Specialization for std::shared_ptr. shared_ptr<T>::get is not marked as volatile.
+ */
+template<typename T>
+struct pointer_like_traits<std::shared_ptr<T>>
+{
+    using element_type = T;
+    static constexpr bool volatile_get = false;
+    FORWARD_TO_MEMBER_DETAIL_INLINE
+    static T& deref(const std::shared_ptr<T>& p) noexcept { return *p; }
+};
+
+/**
+ * Specialization for std::unique_ptr. unique_ptr<T, D>::get is not marked as volatile.
+ */
+template<typename T, typename D>
+struct pointer_like_traits<std::unique_ptr<T, D>>
+{
+    using element_type = T;
+    static constexpr bool volatile_get = false;
+    FORWARD_TO_MEMBER_DETAIL_INLINE
+    static T& deref(const std::unique_ptr<T, D>& p) noexcept { return *p; }
+};
+
+} /* End namespace forward_to_member. */
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_MEMORY_HPP__ */
@@ -0,0 +1,64 @@
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+import forward_to_member;
+#include "forward_to_member_macros.hpp"
+
+/**
+ * Simple structure for testing, with overloads in several cv classes.
+ */
+struct foo
+{
+    int value = 0;
+
+    int get() const { return value; }
+    void set(int v) { value = v; }
+    int add(int a, int b) volatile { return a + b; }
+};
+
+/**
+ * Forwards to members of every pointer kind with the templates imported from the module.
+ */
+struct bar
+{
+    foo v;
+    foo* p;
+    std::shared_ptr<foo> s;
+    std::unique_ptr<foo> u;
+    std::reference_wrapper<foo> r;
+
+    FORWARD_TO_MEMBER_ALL(v, get, set, add);
+    FORWARD_TO_MEMBER_AS(p, get, p_get);
+    FORWARD_TO_MEMBER_AS(s, set, s_set);
+    FORWARD_TO_MEMBER_AS(u, get, u_get);
+    FORWARD_TO_MEMBER_AS(r, set, r_set);
+};
+
+static_assert(detail::is_pointer_like<std::shared_ptr<foo>>::value, "shared_ptr is pointer-like");
+static_assert(detail::is_pointer_like<std::reference_wrapper<foo>>::value, "reference_wrapper too");
+static_assert(!detail::is_pointer_like<foo*>::value, "a raw pointer is a pointer");
+static_assert(std::is_same<foo, detail::forward_member_underlying_type<const foo*>::type>::value,
+              "the underlying type of a pointer is the type it points to");
+
+int main()
+{
+    foo pointed;
+    foo referred;
+    bar b{foo(), &pointed, std::make_shared<foo>(), std::unique_ptr<foo>(new foo()), referred};
+    const bar& cb = b;
+    volatile bar& vb = b;
+
+    b.set(1);
+    assert(1 == cb.get());
+    assert(5 == vb.add(2, 3));
+    pointed.value = 2;
+    assert(2 == cb.p_get());
+    b.s_set(3);
+    assert(3 == b.s->value);
+    b.u->value = 4;
+    assert(4 == cb.u_get());
+    b.r_set(5);
+    assert(5 == referred.value);
+}
@@ -0,0 +1,135 @@
+/**
+ * This file provides detail::call_result, where forward_to_member_actor.hpp and
+ * forward_to_member_async.hpp keep the result of a call run on another thread until the caller
+ * reads it from its future.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_RESULT_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_RESULT_HPP__
+
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace detail
+{
+
+/**
+ * The result of a call run on another thread: its value, or the exception it threw, stored by run
+ * on the thread running the call and moved out, or rethrown, by take on the caller's.
+ */
+template<typename R>
+class call_result
+{
+public:
+    call_result() noexcept : has_value(false) { }
+
+    call_result(const call_result&) = delete;
+    call_result& operator=(const call_result&) = delete;
+
+    ~call_result()
+    {
+        if (has_value)
+        {
+            static_cast<R*>(storage())->~R();
+        }
+    }
+
+    template<typename Call>
+    void run(Call&& call)
+    {
+        try
+        {
+            ::new (storage()) R(call());
+            has_value = true;
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+    }
+
+    R take()
+    {
+        if (!has_value)
+        {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*static_cast<R*>(storage()));
+    }
+
+private:
+    void* storage() noexcept
+    {
+        return &value;
+    }
+
+    typename std::aligned_storage<sizeof(R), alignof(R)>::type value;
+    std::exception_ptr exception;
+    bool has_value;
+};
+
+template<typename R>
+class call_result<R&>
+{
+public:
+    template<typename Call>
+    void run(Call&& call)
+    {
+        try
+        {
+            value = &call();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+    }
+
+    R& take()
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+        return *value;
+    }
+
+private:
+    R* value;
+    std::exception_ptr exception;
+};
+
+template<>
+class call_result<void>
+{
+public:
+    template<typename Call>
+    void run(Call&& call)
+    {
+        try
+        {
+            call();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+    }
+
+    void take()
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    std::exception_ptr exception;
+};
+
+} /* End namespace detail. */
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_RESULT_HPP__ */
@@ -0,0 +1,480 @@
+/**
+ * This file provides forward_to_member::atomic_snapshot, a shared_ptr that can be replaced while
+ * other threads read through it, and the FORWARD_TO_MEMBER_SNAPSHOT macro forwarding to one:
+ *
+ *     class service
+ *     {
+ *     private:
+ *         forward_to_member::atomic_snapshot<const config> settings;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_SNAPSHOT(settings, timeout, timeout);
+ *         void reload(std::shared_ptr<const config> c) { settings.publish(std::move(c)); }
+ *     };
+ *
+ * Every call of an exposed function loads the current object and keeps it alive until the call
+ * returns, in the manner of read-copy-update: a writer publishing a replacement doesn't wait for
+ * the readers, which finish with the object they loaded, the last of them releasing it. Neither
+ * loading nor publishing takes a lock. Each version is held by a node, which a reader announces
+ * in a hazard pointer of its thread while it copies the node's shared_ptr, and a writer frees the
+ * nodes it replaced unless a reader has announced them, leaving those to a later publication.
+ * Loading costs the announcement and an atomic increment and decrement of the reference count; a
+ * forward_to_member::snapshot_scope pins the objects loaded by the calls in its scope on its
+ * thread instead, so a batch of calls sees a single version of each object and pays for the load
+ * only once.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_SNAPSHOT_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_SNAPSHOT_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "forward_to_member.hpp"
+
+namespace detail
+{
+
+/**
+ * Hazard pointer of a thread, announcing the node of an atomic_snapshot whose object the thread
+ * is copying so that writers don't free the node meanwhile. The records form a list that only
+ * grows: a thread takes a free record the first time it loads a snapshot and gives it back when
+ * it exits, so there are no more records than threads that have loaded at once.
+ */
+class snapshot_hazard
+{
+public:
+    std::atomic<const void*> pointer;
+
+    /**
+     * The record of the calling thread.
+     */
+    static snapshot_hazard& mine()
+    {
+        static thread_local holder held;
+        return *held.record;
+    }
+
+    /**
+     * True if a thread has announced node.
+     */
+    static bool announced(const void* node) noexcept
+    {
+        for (snapshot_hazard* h = head().load(std::memory_order_acquire); h; h = h->next)
+        {
+            if (h->pointer.load(std::memory_order_seq_cst) == node)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /**
+     * Takes a record for a thread and gives it back when the thread exits.
+     */
+    struct holder
+    {
+        snapshot_hazard* record;
+
+        holder() : record(take()) { }
+
+        ~holder()
+        {
+            record->pointer.store(nullptr, std::memory_order_relaxed);
+            record->taken.store(false, std::memory_order_release);
+        }
+    };
+
+    snapshot_hazard() noexcept : pointer(nullptr), taken(true), next(nullptr) { }
+
+    static std::atomic<snapshot_hazard*>& head() noexcept
+    {
+        static std::atomic<snapshot_hazard*> records(nullptr);
+        return records;
+    }
+
+    static snapshot_hazard* take()
+    {
+        for (snapshot_hazard* h = head().load(std::memory_order_acquire); h; h = h->next)
+        {
+            if (!h->taken.load(std::memory_order_relaxed) &&
+                !h->taken.exchange(true, std::memory_order_acquire))
+            {
+                return h;
+            }
+        }
+        snapshot_hazard* h = new snapshot_hazard();
+        h->next = head().load(std::memory_order_relaxed);
+        while (!head().compare_exchange_weak(h->next, h, std::memory_order_release,
+                                             std::memory_order_relaxed))
+        {
+        }
+        return h;
+    }
+
+    std::atomic<bool> taken;
+    snapshot_hazard* next;
+};
+
+/**
+ * A version published in an atomic_snapshot. The object is never changed once the node is
+ * published, so readers can copy it while it is current. next links the nodes that were replaced
+ * but not freed yet.
+ */
+template<typename T>
+struct snapshot_node
+{
+    std::shared_ptr<T> object;
+    snapshot_node* next;
+};
+
+} /* End namespace detail. */
+
+namespace forward_to_member
+{
+
+template<typename T>
+class atomic_snapshot;
+
+/**
+ * Pins, for the thread constructing it and until it is destroyed, the object each atomic_snapshot
+ * holds when it is first read in the scope. Later reads of the same atomic_snapshot on the thread
+ * get the pinned object without touching its reference count, whatever has been published since.
+ * Scopes nest; an inner scope also sees the objects pinned by the outer ones.
+ */
+class snapshot_scope
+{
+public:
+    snapshot_scope() : outer(current()), count(0)
+    {
+        current() = this;
+    }
+
+    snapshot_scope(const snapshot_scope&) = delete;
+    snapshot_scope& operator=(const snapshot_scope&) = delete;
+
+    ~snapshot_scope()
+    {
+        current() = outer;
+    }
+
+private:
+    template<typename T>
+    friend class atomic_snapshot;
+
+    /**
+     * An object pinned for an atomic_snapshot, held through a shared_ptr aliasing its own.
+     */
+    struct pin
+    {
+        const void* holder;
+        std::shared_ptr<void> object;
+    };
+
+    static snapshot_scope*& current() noexcept
+    {
+        static thread_local snapshot_scope* scope = nullptr;
+        return scope;
+    }
+
+    /**
+     * Gets the object pinned for holder by this scope or an outer one, or null.
+     */
+    void* find(const void* holder) const noexcept
+    {
+        for (const snapshot_scope* scope = this; scope; scope = scope->outer)
+        {
+            for (std::size_t i = 0; i < scope->count; ++i)
+            {
+                if (scope->pins[i].holder == holder)
+                {
+                    return scope->pins[i].object.get();
+                }
+            }
+            for (const pin& p : scope->more)
+            {
+                if (p.holder == holder)
+                {
+                    return p.object.get();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void add(const void* holder, std::shared_ptr<void> object)
+    {
+        if (count < inline_pins)
+        {
+            pins[count++] = pin{holder, std::move(object)};
+        }
+        else
+        {
+            more.push_back(pin{holder, std::move(object)});
+        }
+    }
+
+    static constexpr std::size_t inline_pins = 4;
+
+    snapshot_scope* outer;
+    pin pins[inline_pins];
+    std::size_t count;
+    std::vector<pin> more;
+};
+
+/**
+ * Reference to the object an atomic_snapshot held when it was read. It owns a reference to the
+ * object unless the object is pinned by a snapshot_scope.
+ */
+template<typename T>
+class snapshot_ref
+{
+public:
+    snapshot_ref(T* object, std::shared_ptr<T> owner) noexcept
+        : object(object), owner(std::move(owner)) { }
+
+    T& operator*() const noexcept { return *object; }
+    T* operator->() const noexcept { return object; }
+    T* get() const noexcept { return object; }
+
+private:
+    T* object;
+    std::shared_ptr<T> owner;
+};
+
+/**
+ * shared_ptr that threads can read while others replace it. Readers get the object held at the
+ * time of the read and keep it alive for as long as they use it. Neither readers nor writers take
+ * a lock: a reader only retries if a writer publishes while it loads, and writers never wait for
+ * readers. A replaced object that a reader was loading when it was replaced is released by a later
+ * publication or by the destructor.
+ */
+template<typename T>
+class atomic_snapshot
+{
+    using node = detail::snapshot_node<T>;
+
+public:
+    using element_type = T;
+
+    atomic_snapshot() noexcept : current(nullptr), retired(nullptr) { }
+
+    explicit atomic_snapshot(std::shared_ptr<T> object)
+        : current(object ? new node{std::move(object), nullptr} : nullptr), retired(nullptr) { }
+
+    atomic_snapshot(const atomic_snapshot&) = delete;
+    atomic_snapshot& operator=(const atomic_snapshot&) = delete;
+
+    ~atomic_snapshot()
+    {
+        delete current.load(std::memory_order_relaxed);
+        for (node* n = retired.load(std::memory_order_relaxed); n; )
+        {
+            node* next = n->next;
+            delete n;
+            n = next;
+        }
+    }
+
+    /**
+     * Gets the current object, or the one pinned by an enclosing snapshot_scope.
+     */
+    snapshot_ref<T> read() const
+    {
+        snapshot_scope* scope = snapshot_scope::current();
+        if (!scope)
+        {
+            std::shared_ptr<T> object = load();
+            T* raw = object.get();
+            return snapshot_ref<T>(raw, std::move(object));
+        }
+        if (void* pinned = scope->find(this))
+        {
+            return snapshot_ref<T>(static_cast<T*>(pinned), nullptr);
+        }
+        std::shared_ptr<T> object = load();
+        T* raw = object.get();
+        scope->add(this, std::shared_ptr<void>(std::move(object),
+                                               const_cast<void*>(static_cast<const void*>(raw))));
+        return snapshot_ref<T>(raw, nullptr);
+    }
+
+    /**
+     * Gets the current object, ignoring snapshot scopes.
+     */
+    std::shared_ptr<T> load() const
+    {
+        detail::snapshot_hazard& hazard = detail::snapshot_hazard::mine();
+        node* n = protect(hazard);
+        std::shared_ptr<T> object = n ? n->object : nullptr;
+        hazard.pointer.store(nullptr, std::memory_order_release);
+        return object;
+    }
+
+    /**
+     * Replaces the object, returning the previous one. Readers still using the previous object
+     * keep it alive.
+     */
+    std::shared_ptr<T> publish(std::shared_ptr<T> object)
+    {
+        node* fresh = object ? new node{std::move(object), nullptr} : nullptr;
+        node* previous = current.exchange(fresh, std::memory_order_seq_cst);
+        std::shared_ptr<T> replaced = previous ? previous->object : nullptr;
+        retire(previous);
+        return replaced;
+    }
+
+    /**
+     * Replaces the object by make(current), where current is the object held, retrying with the
+     * new current object if another writer replaced it in the meantime. make must not have side
+     * effects since it can be called several times. Returns the object published.
+     */
+    template<typename Make>
+    std::shared_ptr<T> replace(Make make)
+    {
+        std::unique_ptr<node> fresh(new node{nullptr, nullptr});
+        std::shared_ptr<T> expected = load();
+        for (;;)
+        {
+            std::shared_ptr<T> desired = make(static_cast<const std::shared_ptr<T>&>(expected));
+            fresh->object = desired;
+            detail::snapshot_hazard& hazard = detail::snapshot_hazard::mine();
+            node* n = protect(hazard);
+            node* seen = n;
+            if ((n ? n->object.get() : nullptr) == expected.get() &&
+                current.compare_exchange_strong(seen, fresh.get(), std::memory_order_seq_cst))
+            {
+                hazard.pointer.store(nullptr, std::memory_order_release);
+                fresh.release();
+                retire(n);
+                return desired;
+            }
+            hazard.pointer.store(nullptr, std::memory_order_release);
+            expected = load();
+        }
+    }
+
+private:
+    /**
+     * Announces the current node in hazard and returns it once it is still current after the
+     * announcement, so that it cannot be freed until the announcement is withdrawn.
+     */
+    node* protect(detail::snapshot_hazard& hazard) const noexcept
+    {
+        node* n = current.load(std::memory_order_acquire);
+        for (;;)
+        {
+            hazard.pointer.store(n, std::memory_order_seq_cst);
+            node* again = current.load(std::memory_order_seq_cst);
+            if (again == n)
+            {
+                return n;
+            }
+            n = again;
+        }
+    }
+
+    /**
+     * Frees the nodes replaced so far, including n, except those a reader has announced, which are
+     * kept for a later publication.
+     */
+    void retire(node* n)
+    {
+        if (n)
+        {
+            push(n);
+        }
+        for (node* r = retired.exchange(nullptr, std::memory_order_acquire); r; )
+        {
+            node* next = r->next;
+            if (detail::snapshot_hazard::announced(r))
+            {
+                push(r);
+            }
+            else
+            {
+                delete r;
+            }
+            r = next;
+        }
+    }
+
+    void push(node* n) noexcept
+    {
+        n->next = retired.load(std::memory_order_relaxed);
+        while (!retired.compare_exchange_weak(n->next, n, std::memory_order_release,
+                                              std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::atomic<node*> current;
+    std::atomic<node*> retired;
+};
+
+} /* End namespace forward_to_member. */
+
+namespace detail
+{
+
+/**
+ * An atomic_snapshot does not own its object, which outlives an rvalue holder when readers still
+ * use it, so functions are always called on an lvalue.
+ */
+template<typename T>
+struct is_owned_member<forward_to_member::atomic_snapshot<T>> : public std::false_type { };
+
+/**
+ * The operations of an atomic_snapshot are not volatile, so volatile overloads are exposed
+ * as non-volatile functions, as with shared_ptr.
+ */
+template<typename T>
+struct is_volatile_accessible<forward_to_member::atomic_snapshot<T>, false>
+    : public std::false_type { };
+
+/**
+ * Reads an atomic_snapshot member. The leading TArgs keep the call dependent, like
+ * forward_member_deref.
+ */
+template<typename... TArgs, typename T>
+forward_to_member::snapshot_ref<T> forward_member_snapshot(
+    const forward_to_member::atomic_snapshot<T>& member)
+{
+    return member.read();
+}
+
+} /* End namespace detail. */
+
+/**
+ * Call macro for FORWARD_TO_MEMBER_DETAIL_EXPOSE reading the snapshot. The snapshot_ref is a
+ * temporary of the full expression, so the object stays alive until the result is constructed.
+ * The object is made const if the function is, so the overload classified is the one called.
+ */
+#define FORWARD_TO_MEMBER_DETAIL_CALL_SNAPSHOT(m, f, n, object, forwarded_args)                    \
+    detail::forward_member_as_const<                                                               \
+        function_traits_##m##_##f##_##n<member_type_##m##_##f##_##n&, TArgs...>::has_const>(       \
+        *detail::forward_member_snapshot<TArgs...>(object)).f(forwarded_args)
+
+/**
+ * Generates code which exposes a function in some class that invokes a method (potentially having
+ * several overloads) on the object held by a forward_to_member::atomic_snapshot member, loading
+ * the object for each call unless a forward_to_member::snapshot_scope has pinned it. The exposed
+ * function inherits the constness of the method; volatile methods are exposed as non-volatile
+ * functions.
+ *
+ * @param m The name of the atomic_snapshot member holding the object.
+ * @param f The name of the function to invoke on the object.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_SNAPSHOT(m, f, n)                                                        \
+    using member_type_##m##_##f##_##n = std::remove_cv<decltype(m)::element_type>::type;          \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_EXPOSE(m, f, n, member_type_##m##_##f##_##n,                          \
+                                    FORWARD_TO_MEMBER_DETAIL_CALL_SNAPSHOT)
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_SNAPSHOT_HPP__ */
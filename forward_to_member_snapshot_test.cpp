@@ -0,0 +1,218 @@
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include "forward_to_member_snapshot.hpp"
+
+/**
+ * Configuration whose two halves must always agree, checked by readers to detect torn reads, and
+ * which counts its live instances to check that replaced versions are released.
+ */
+struct config
+{
+    static std::atomic<int> live;
+
+    long version;
+    long copy;
+
+    explicit config(long version) : version(version), copy(version) { ++live; }
+    config(const config& other) : version(other.version), copy(other.copy) { ++live; }
+    ~config() { --live; }
+
+    long get() const { assert(version == copy); return version; }
+    long get(long offset) const { return get() + offset; }
+    void set(long v) { version = copy = v; }
+    long bump() volatile { return 1; }
+
+    /**
+     * Signals entered, then keeps the caller in the call until release is set.
+     */
+    long hold(std::atomic<bool>* entered, std::atomic<bool>* release) const
+    {
+        *entered = true;
+        while (!*release)
+        {
+            std::this_thread::yield();
+        }
+        return get();
+    }
+};
+
+std::atomic<int> config::live(0);
+
+/**
+ * Forwards to a configuration that can be replaced at any time.
+ */
+struct service
+{
+    forward_to_member::atomic_snapshot<config> settings;
+    FORWARD_TO_MEMBER_SNAPSHOT(settings, get, version);
+    FORWARD_TO_MEMBER_SNAPSHOT(settings, set, set);
+    FORWARD_TO_MEMBER_SNAPSHOT(settings, bump, bump);
+    FORWARD_TO_MEMBER_SNAPSHOT(settings, hold, hold);
+
+    forward_to_member::atomic_snapshot<const config> frozen;
+    FORWARD_TO_MEMBER_SNAPSHOT(frozen, get, frozen_version);
+
+    service() : settings(std::make_shared<config>(0)), frozen(std::make_shared<config>(-1)) { }
+
+    /**
+     * Publishes a copy of the current configuration with the next version.
+     */
+    long upgrade()
+    {
+        return settings.replace([](const std::shared_ptr<config>& current)
+        {
+            std::shared_ptr<config> next = std::make_shared<config>(*current);
+            next->set(current->version + 1);
+            return next;
+        })->version;
+    }
+};
+
+int main()
+{
+    {
+        service s;
+        const service& sc = s;
+
+        // Calls reach the current object with its cv qualification.
+        assert(0 == sc.version());
+        assert(5 == sc.version(5L));
+        s.set(2);
+        assert(2 == sc.version());
+        assert(1 == s.bump());
+        assert(-1 == sc.frozen_version());
+
+        // Publishing replaces the object for later calls and returns the previous one.
+        std::shared_ptr<config> previous = s.settings.publish(std::make_shared<config>(10));
+        assert(2 == previous->version && 10 == sc.version());
+        previous.reset();
+        assert(2 == config::live);
+
+        // A scope pins the object for the calls made in it on this thread.
+        {
+            forward_to_member::snapshot_scope scope;
+            assert(10 == sc.version());
+            s.settings.publish(std::make_shared<config>(20));
+            assert(10 == sc.version() && 10 == sc.version(0L));
+            assert(3 == config::live);
+            {
+                forward_to_member::snapshot_scope inner;
+                assert(10 == sc.version());
+            }
+        }
+        assert(20 == sc.version());
+        assert(2 == config::live);
+
+        // Readers see versions in the order writers publish them and never a torn object, with
+        // and without scopes.
+        const int writers = 2;
+        const int readers = 4;
+        const int upgrades = 2000;
+        std::atomic<bool> done(false);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < readers; ++i)
+        {
+            threads.emplace_back([&sc, &done, i]()
+            {
+                long last = 0;
+                while (!done)
+                {
+                    if (i % 2)
+                    {
+                        forward_to_member::snapshot_scope scope;
+                        long pinned = sc.version();
+                        for (int j = 0; j < 8; ++j)
+                        {
+                            assert(pinned == sc.version());
+                        }
+                        assert(pinned >= last);
+                        last = pinned;
+                    }
+                    else
+                    {
+                        long current = sc.version();
+                        assert(current >= last);
+                        last = current;
+                    }
+                }
+            });
+        }
+        std::vector<std::thread> upgraders;
+        for (int i = 0; i < writers; ++i)
+        {
+            upgraders.emplace_back([&s]()
+            {
+                for (int j = 0; j < upgrades; ++j)
+                {
+                    s.upgrade();
+                }
+            });
+        }
+        for (auto& upgrader : upgraders)
+        {
+            upgrader.join();
+        }
+        done = true;
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        assert(20 + writers * upgrades == sc.version());
+
+        // A version a reader was loading when it was replaced is released by a later publication.
+        s.upgrade();
+        assert(21 + writers * upgrades == sc.version());
+        assert(2 == config::live);
+
+        // A writer makes progress while a reader is inside a call and others keep loading: its
+        // publications don't wait for them, and the reader inside the call keeps its version.
+        const long held_version = sc.version();
+        std::atomic<bool> entered(false);
+        std::atomic<bool> release(false);
+        std::atomic<long> reads(0);
+        done = false;
+        threads.clear();
+        long held_result = 0;
+        threads.emplace_back([&sc, &entered, &release, &held_result]()
+        {
+            held_result = sc.hold(&entered, &release);
+        });
+        for (int i = 0; i < readers; ++i)
+        {
+            threads.emplace_back([&sc, &done, &reads]()
+            {
+                while (!done)
+                {
+                    sc.version();
+                    ++reads;
+                }
+            });
+        }
+        while (!entered || reads < readers)
+        {
+            std::this_thread::yield();
+        }
+        for (int j = 0; j < upgrades; ++j)
+        {
+            s.upgrade();
+        }
+        assert(!release && held_version + upgrades == sc.version());
+        const long reads_after_upgrades = reads;
+        while (reads < reads_after_upgrades + readers)
+        {
+            std::this_thread::yield();
+        }
+        release = true;
+        done = true;
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        assert(held_version == held_result);
+        s.upgrade();
+        assert(2 == config::live);
+    }
+    assert(0 == config::live);
+}
@@ -0,0 +1,30 @@
+/**
+ * This file provides detail::spin_wait, the backoff of the spin loops of
+ * forward_to_member_locked.hpp and forward_to_member_actor.hpp, so that either can be included
+ * without the other.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_SPIN_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_SPIN_HPP__
+
+#include <thread>
+
+namespace detail
+{
+
+/**
+ * Waits a little in a spin loop, yielding to other threads once it has spun for a while so a
+ * preempted holder of a lock, or another thread being waited for, can run.
+ */
+inline void spin_wait(unsigned& spins) noexcept
+{
+    if (++spins >= 64)
+    {
+        spins = 0;
+        std::this_thread::yield();
+    }
+}
+
+} /* End namespace detail. */
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_SPIN_HPP__ */
@@ -1,42 +1,54 @@
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+#include <vector>
 #include "forward_to_member.hpp"
 
 namespace detail
 {
 
 /**
- * Test all combinations of is_shared_ptr for int.
+ * Test all combinations of is_pointer_like for int.
  */
-#define TEST_IS_SHARED_PTR(t, exp) \
-    static_assert(is_shared_ptr<t>::value == exp, "Unexpected is_shared_ptr result.");
-TEST_IS_SHARED_PTR(int,                                                false);
-TEST_IS_SHARED_PTR(const int,                                          false);
-TEST_IS_SHARED_PTR(volatile int,                                       false);
-TEST_IS_SHARED_PTR(const volatile int,                                 false);
-TEST_IS_SHARED_PTR(int&,                                               false);
-TEST_IS_SHARED_PTR(const int&,                                         false);
-TEST_IS_SHARED_PTR(volatile int&,                                      false);
-TEST_IS_SHARED_PTR(const volatile int&,                                false);
-TEST_IS_SHARED_PTR(int*,                                               false);
-TEST_IS_SHARED_PTR(const int*,                                         false);
-TEST_IS_SHARED_PTR(volatile int*,                                      false);
-TEST_IS_SHARED_PTR(const volatile int*,                                false);
-TEST_IS_SHARED_PTR(std::shared_ptr<int>,                               true);
-TEST_IS_SHARED_PTR(std::shared_ptr<const int>,                         true);
-TEST_IS_SHARED_PTR(std::shared_ptr<volatile int>,                      true);
-TEST_IS_SHARED_PTR(std::shared_ptr<const volatile int>,                true);
-TEST_IS_SHARED_PTR(const std::shared_ptr<int>,                         true);
-TEST_IS_SHARED_PTR(const std::shared_ptr<const int>,                   true);
-TEST_IS_SHARED_PTR(const std::shared_ptr<volatile int>,                true);
-TEST_IS_SHARED_PTR(const std::shared_ptr<const volatile int>,          true);
-TEST_IS_SHARED_PTR(volatile std::shared_ptr<int>,                      true);
-TEST_IS_SHARED_PTR(volatile std::shared_ptr<const int>,                true);
-TEST_IS_SHARED_PTR(volatile std::shared_ptr<volatile int>,             true);
-TEST_IS_SHARED_PTR(volatile std::shared_ptr<const volatile int>,       true);
-TEST_IS_SHARED_PTR(const volatile std::shared_ptr<int>,                true);
-TEST_IS_SHARED_PTR(const volatile std::shared_ptr<const int>,          true);
-TEST_IS_SHARED_PTR(const volatile std::shared_ptr<volatile int>,       true);
-TEST_IS_SHARED_PTR(const volatile std::shared_ptr<const volatile int>, true);
+#define TEST_IS_POINTER_LIKE(t, exp) \
+    static_assert(is_pointer_like<t>::value == exp, "Unexpected is_pointer_like result.");
+TEST_IS_POINTER_LIKE(int,                                                false);
+TEST_IS_POINTER_LIKE(const int,                                          false);
+TEST_IS_POINTER_LIKE(volatile int,                                       false);
+TEST_IS_POINTER_LIKE(const volatile int,                                 false);
+TEST_IS_POINTER_LIKE(int&,                                               false);
+TEST_IS_POINTER_LIKE(const int&,                                         false);
+TEST_IS_POINTER_LIKE(volatile int&,                                      false);
+TEST_IS_POINTER_LIKE(const volatile int&,                                false);
+TEST_IS_POINTER_LIKE(int*,                                               false);
+TEST_IS_POINTER_LIKE(const int*,                                         false);
+TEST_IS_POINTER_LIKE(volatile int*,                                      false);
+TEST_IS_POINTER_LIKE(const volatile int*,                                false);
+TEST_IS_POINTER_LIKE(std::shared_ptr<int>,                               true);
+TEST_IS_POINTER_LIKE(std::shared_ptr<const int>,                         true);
+TEST_IS_POINTER_LIKE(std::shared_ptr<volatile int>,                      true);
+TEST_IS_POINTER_LIKE(std::shared_ptr<const volatile int>,                true);
+TEST_IS_POINTER_LIKE(const std::shared_ptr<int>,                         true);
+TEST_IS_POINTER_LIKE(const std::shared_ptr<const int>,                   true);
+TEST_IS_POINTER_LIKE(const std::shared_ptr<volatile int>,                true);
+TEST_IS_POINTER_LIKE(const std::shared_ptr<const volatile int>,          true);
+TEST_IS_POINTER_LIKE(volatile std::shared_ptr<int>,                      true);
+TEST_IS_POINTER_LIKE(volatile std::shared_ptr<const int>,                true);
+TEST_IS_POINTER_LIKE(volatile std::shared_ptr<volatile int>,             true);
+TEST_IS_POINTER_LIKE(volatile std::shared_ptr<const volatile int>,       true);
+TEST_IS_POINTER_LIKE(const volatile std::shared_ptr<int>,                true);
+TEST_IS_POINTER_LIKE(const volatile std::shared_ptr<const int>,          true);
+TEST_IS_POINTER_LIKE(const volatile std::shared_ptr<volatile int>,       true);
+TEST_IS_POINTER_LIKE(const volatile std::shared_ptr<const volatile int>, true);
+TEST_IS_POINTER_LIKE(std::unique_ptr<int>,                               true);
+TEST_IS_POINTER_LIKE(std::unique_ptr<const volatile int>,                true);
+TEST_IS_POINTER_LIKE(const std::unique_ptr<int>,                         true);
+TEST_IS_POINTER_LIKE(volatile std::unique_ptr<const int>,                true);
+TEST_IS_POINTER_LIKE(std::reference_wrapper<int>,                        true);
+TEST_IS_POINTER_LIKE(std::reference_wrapper<const int>,                  true);
+TEST_IS_POINTER_LIKE(const std::reference_wrapper<volatile int>,         true);
+TEST_IS_POINTER_LIKE(std::shared_ptr<int>&,                              true);
+TEST_IS_POINTER_LIKE(const std::unique_ptr<int>&,                        true);
 
 /**
  * Test all combinations of forward_member_underlying_type for int.
@@ -72,9 +84,49 @@ TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const volatile std::shared_ptr<int>);
 TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const volatile std::shared_ptr<const int>);
 TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const volatile std::shared_ptr<volatile int>);
 TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const volatile std::shared_ptr<const volatile int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(std::unique_ptr<int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(std::unique_ptr<const int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const std::unique_ptr<volatile int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const volatile std::unique_ptr<const volatile int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(std::reference_wrapper<int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(std::reference_wrapper<const int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const std::reference_wrapper<const volatile int>);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(std::shared_ptr<int>&);
+TEST_FORWARD_MEMBER_UNDERLYING_TYPE(const std::unique_ptr<const int>&);
 
 } /* End of namespace detail. */
 
+/**
+ * Minimal user-defined smart pointer standing in for an intrusive or otherwise custom pointer. Unlike
+ * std::shared_ptr its get is volatile, so it can be used from volatile objects.
+ */
+template <typename T>
+class observer_ptr
+{
+private:
+    T* ptr;
+
+public:
+    explicit observer_ptr(T* p) : ptr(p) { }
+    T* get() const volatile { return ptr; }
+};
+
+namespace forward_to_member
+{
+
+/**
+ * Makes observer_ptr usable with FORWARD_TO_MEMBER_AS, including from volatile objects.
+ */
+template <typename T>
+struct pointer_like_traits<observer_ptr<T>>
+{
+    using element_type = T;
+    static constexpr bool volatile_get = true;
+    static T& deref(const volatile observer_ptr<T>& p) noexcept { return *p.get(); }
+};
+
+} /* End of namespace forward_to_member. */
+
 /**
  * Simple structure for testing containing a function that has all possible cv overloads.
  */
@@ -84,11 +136,13 @@ struct foo
     int func1(int i, int j) volatile { return i + j; }
     int func1(int i, int j, int k) const { return i + j + k; }
     int func1(int i, int j, int k, int l) const volatile { return i + j + k + l; }
+    int func2(int i) noexcept { return i; }
+    int func2(int i, int j) const { return i + j; }
 };
 
 /**
- * Simple structure containing foo members of various types (pointers, references, shared_ptr) and
- * cv qualifications. This structure will "forward" all function calls to the contained foo
+ * Simple structure containing foo members of various types (pointers, references, smart pointers)
+ * and cv qualifications. This structure will "forward" all function calls to the contained foo
  * structure.
  */
 struct bar
@@ -165,6 +219,40 @@ struct bar
     const std::shared_ptr<const volatile foo> fcspcv;
     FORWARD_TO_MEMBER_AS(fcspcv, func1, fcspcv_func1);
 
+    std::unique_ptr<foo> fup;
+    FORWARD_TO_MEMBER_AS(fup, func1, fup_func1);
+
+    std::unique_ptr<volatile foo> fupv;
+    FORWARD_TO_MEMBER_AS(fupv, func1, fupv_func1);
+
+    std::unique_ptr<const foo> fupc;
+    FORWARD_TO_MEMBER_AS(fupc, func1, fupc_func1);
+
+    std::unique_ptr<const volatile foo> fupcv;
+    FORWARD_TO_MEMBER_AS(fupcv, func1, fupcv_func1);
+
+    std::reference_wrapper<foo> frw;
+    FORWARD_TO_MEMBER_AS(frw, func1, frw_func1);
+
+    std::reference_wrapper<const foo> frwc;
+    FORWARD_TO_MEMBER_AS(frwc, func1, frwc_func1);
+
+    observer_ptr<foo> fop;
+    FORWARD_TO_MEMBER_AS(fop, func1, fop_func1);
+
+    observer_ptr<const foo> fopc;
+    FORWARD_TO_MEMBER_AS(fopc, func1, fopc_func1);
+
+    // Forward a function with a noexcept and a potentially throwing overload through each kind of
+    // member.
+    FORWARD_TO_MEMBER_AS(f, func2, f_func2);
+    FORWARD_TO_MEMBER_AS(fr, func2, fr_func2);
+    FORWARD_TO_MEMBER_AS(fp, func2, fp_func2);
+    FORWARD_TO_MEMBER_AS(fsp, func2, fsp_func2);
+    FORWARD_TO_MEMBER_AS(fup, func2, fup_func2);
+    FORWARD_TO_MEMBER_AS(frw, func2, frw_func2);
+    FORWARD_TO_MEMBER_AS(fop, func2, fop_func2);
+
     bar(foo& obj):
         f(obj),
         fv(obj),
@@ -189,10 +277,307 @@ struct bar
         fcsp(std::make_shared<foo>(obj)),
         fcspv(std::make_shared<volatile foo>(obj)),
         fcspc(std::make_shared<const foo>(obj)),
-        fcspcv(std::make_shared<const volatile foo>(obj))
+        fcspcv(std::make_shared<const volatile foo>(obj)),
+        fup(new foo(obj)),
+        fupv(new volatile foo(obj)),
+        fupc(new const foo(obj)),
+        fupcv(new const volatile foo(obj)),
+        frw(obj),
+        frwc(obj),
+        fop(&obj),
+        fopc(&obj)
     { }
 };
 
+/**
+ * Simple structure for testing FORWARD_TO_MEMBER_ALL containing one function of each cv class.
+ */
+struct qux
+{
+    int plain() noexcept { return 1; }
+    int vol(int i) volatile { return i; }
+    int con(int i, int j) const { return i + j; }
+    int cv(int i, int j, int k) const volatile { return i + j + k; }
+};
+
+/**
+ * Declares a structure that forwards every function of qux to a member of the given type using a
+ * single FORWARD_TO_MEMBER_ALL.
+ */
+#define QUX_WRAPPER(name, type, init)                  \
+    struct name                                        \
+    {                                                  \
+        type q;                                        \
+        FORWARD_TO_MEMBER_ALL(q, plain, vol, con, cv); \
+        name(qux& obj) : q(init) { }                   \
+    }
+QUX_WRAPPER(qux_value,    qux,                  obj);
+QUX_WRAPPER(qux_ref,      qux&,                 obj);
+QUX_WRAPPER(qux_ptr,      qux*,                 &obj);
+QUX_WRAPPER(qux_shared,   std::shared_ptr<qux>, std::make_shared<qux>(obj));
+QUX_WRAPPER(qux_observer, observer_ptr<qux>,    observer_ptr<qux>(&obj));
+
+/**
+ * Simple structure for testing which of two overloads differing only in constness
+ * FORWARD_TO_MEMBER_ALL calls.
+ */
+struct twin
+{
+    int get() { return 1; }
+    int get() const { return 2; }
+};
+
+/**
+ * Declares a structure that forwards get of twin to a member of the given type both with
+ * FORWARD_TO_MEMBER_ALL and with FORWARD_TO_MEMBER_AS, which must call the same overload.
+ */
+#define TWIN_WRAPPER(name, type, init)                 \
+    struct name                                        \
+    {                                                  \
+        type t;                                        \
+        FORWARD_TO_MEMBER_ALL(t, get);                 \
+        FORWARD_TO_MEMBER_AS(t, get, single_get);      \
+        name(twin& obj) : t(init) { }                  \
+    }
+TWIN_WRAPPER(twin_value,    twin,                         obj);
+TWIN_WRAPPER(twin_ptr,      twin*,                        &obj);
+TWIN_WRAPPER(twin_shared,   std::shared_ptr<twin>,        std::make_shared<twin>(obj));
+TWIN_WRAPPER(twin_unique,   std::unique_ptr<twin>,        new twin(obj));
+TWIN_WRAPPER(twin_ref,      std::reference_wrapper<twin>, std::ref(obj));
+TWIN_WRAPPER(twin_observer, observer_ptr<twin>,           observer_ptr<twin>(&obj));
+
+/**
+ * Holds a foo through a value, a pointer and a shared pointer, as the middle of the paths of
+ * chain, and a link after it, as the middle of a longer path.
+ */
+struct link
+{
+    foo f;
+    foo* fp;
+    std::shared_ptr<foo> fsp;
+    link* next;
+    link(foo& obj) : f(obj), fp(&obj), fsp(std::make_shared<foo>(obj)), next(this) { }
+};
+
+/**
+ * Simple structure forwarding func1 of foo along a path of two members for each combination of
+ * value, pointer and shared pointer, and along a longer path and one through a pointer to const.
+ */
+struct chain
+{
+    link l;
+    link* lp;
+    std::shared_ptr<link> lsp;
+    const link* lcp;
+    FORWARD_TO_MEMBER_PATH((l, f), func1, l_f);
+    FORWARD_TO_MEMBER_PATH((l, fp), func1, l_fp);
+    FORWARD_TO_MEMBER_PATH((l, fsp), func1, l_fsp);
+    FORWARD_TO_MEMBER_PATH((lp, f), func1, lp_f);
+    FORWARD_TO_MEMBER_PATH((lp, fp), func1, lp_fp);
+    FORWARD_TO_MEMBER_PATH((lp, fsp), func1, lp_fsp);
+    FORWARD_TO_MEMBER_PATH((lsp, f), func1, lsp_f);
+    FORWARD_TO_MEMBER_PATH((lsp, fp), func1, lsp_fp);
+    FORWARD_TO_MEMBER_PATH((lsp, fsp), func1, lsp_fsp);
+    FORWARD_TO_MEMBER_PATH((lcp, fp), func1, lcp_fp);
+    FORWARD_TO_MEMBER_PATH((lp, next, next, fp), func1, lp_next_fp);
+    FORWARD_TO_MEMBER_PATH((l, f), func2, l_f_func2);
+    FORWARD_TO_MEMBER_PATH((lsp, fp), func2, lsp_fp_func2);
+    chain(foo& obj) : l(obj), lp(&l), lsp(std::make_shared<link>(obj)), lcp(&l) { }
+};
+
+/**
+ * Simple structure for testing ref-qualified functions. take copies from an lvalue and steals from
+ * an rvalue, while each of the other functions can only be called on one value category.
+ */
+struct buffer
+{
+    int take() const & { return 1; }
+    int take() && { return 2; }
+    int peek(int i) & { return i; }
+    int drop(int i, int j) const && { return i + j; }
+    int wipe(int i, int j, int k) volatile && { return i + j + k; }
+};
+
+/**
+ * Declares a structure that forwards every function of buffer to a member of the given type using
+ * a single FORWARD_TO_MEMBER_ALL.
+ */
+#define BUFFER_WRAPPER(name, type, init)                    \
+    struct name                                             \
+    {                                                       \
+        type u;                                             \
+        FORWARD_TO_MEMBER_ALL(u, take, peek, drop, wipe);   \
+        name(buffer& obj) : u(init) { }                     \
+    }
+BUFFER_WRAPPER(buffer_value,  buffer,                  obj);
+BUFFER_WRAPPER(buffer_ref,    buffer&,                 obj);
+BUFFER_WRAPPER(buffer_ptr,    buffer*,                 &obj);
+BUFFER_WRAPPER(buffer_unique, std::unique_ptr<buffer>, new buffer(obj));
+
+/**
+ * Same as buffer_value except every function is forwarded with its own FORWARD_TO_MEMBER.
+ */
+struct buffer_value_as
+{
+    buffer u;
+    FORWARD_TO_MEMBER(u, take);
+    FORWARD_TO_MEMBER(u, peek);
+    FORWARD_TO_MEMBER(u, drop);
+    FORWARD_TO_MEMBER(u, wipe);
+    buffer_value_as(buffer& obj) : u(obj) { }
+};
+
+/**
+ * Number of times a tally was copied and moved, to check that FORWARD_TO_MEMBER_FIELD exposes
+ * fields by reference.
+ */
+static int copies = 0;
+static int moves = 0;
+
+struct tally
+{
+    int count;
+    tally(int i) : count(i) { }
+    tally(const tally& other) : count(other.count) { ++copies; }
+    tally(tally&& other) noexcept : count(other.count) { ++moves; }
+};
+
+/**
+ * Simple structure for testing FORWARD_TO_MEMBER_FIELD with a class and an array field.
+ */
+struct record
+{
+    tally total;
+    int slots[2];
+};
+
+/**
+ * Declares a structure that exposes both fields of record through a member of the given type.
+ */
+#define RECORD_WRAPPER(name, type, init)                    \
+    struct name                                             \
+    {                                                       \
+        type r;                                             \
+        FORWARD_TO_MEMBER_FIELD(r, total, total);           \
+        FORWARD_TO_MEMBER_FIELD(r, slots, slots);           \
+        name(record& obj) : r(init) { }                     \
+    }
+RECORD_WRAPPER(record_value,     record,                        obj);
+RECORD_WRAPPER(record_ref,       record&,                       obj);
+RECORD_WRAPPER(record_ptr,       record*,                       &obj);
+RECORD_WRAPPER(record_ptrc,      const record*,                 &obj);
+RECORD_WRAPPER(record_shared,    std::shared_ptr<record>,       std::make_shared<record>(obj));
+RECORD_WRAPPER(record_sharedc,   std::shared_ptr<const record>, std::make_shared<record>(obj));
+RECORD_WRAPPER(record_unique,    std::unique_ptr<record>,       new record(obj));
+RECORD_WRAPPER(record_observer,  observer_ptr<record>,          observer_ptr<record>(&obj));
+
+/**
+ * Simple callable for testing FORWARD_TO_MEMBER_OPERATOR with a const and a non-const operator().
+ */
+struct gain
+{
+    int factor;
+    int operator()(int i) const noexcept { return factor * i; }
+    int operator()(int i) { return ++factor * i; }
+};
+
+/**
+ * Declares a structure that exposes the range of a vector member and its subscript operator, and
+ * the call operator of a gain member, through members of the given types.
+ */
+#define SERIES_WRAPPER(name, type, init, gain_type, gain_init)                 \
+    struct name                                                                \
+    {                                                                          \
+        type v;                                                                \
+        gain_type g;                                                           \
+        FORWARD_TO_MEMBER_RANGE(v);                                            \
+        FORWARD_TO_MEMBER_OPERATOR(v, []);                                     \
+        FORWARD_TO_MEMBER_OPERATOR(g, ());                                     \
+        name(std::vector<int>& obj, gain& k) : v(init), g(gain_init) { }       \
+    }
+SERIES_WRAPPER(series_value,  std::vector<int>,                  obj,                                     gain,                  k);
+SERIES_WRAPPER(series_ref,    std::vector<int>&,                 obj,                                     gain&,                 k);
+SERIES_WRAPPER(series_ptr,    std::vector<int>*,                 &obj,                                    gain*,                 &k);
+SERIES_WRAPPER(series_ptrc,   const std::vector<int>*,           &obj,                                    const gain*,           &k);
+SERIES_WRAPPER(series_shared, std::shared_ptr<std::vector<int>>, std::make_shared<std::vector<int>>(obj), std::shared_ptr<gain>, std::make_shared<gain>(k));
+SERIES_WRAPPER(series_unique, std::unique_ptr<std::vector<int>>, new std::vector<int>(obj),               std::unique_ptr<gain>, new gain(k));
+
+/**
+ * Checks that the function exposed by FORWARD_TO_MEMBER_FIELD, FORWARD_TO_MEMBER_OPERATOR or
+ * FORWARD_TO_MEMBER_RANGE called by the given expression returns R.
+ */
+#define TEST_EXPOSED_TYPE(expr, R) \
+    static_assert(std::is_same<decltype(expr), R>::value, "Unexpected exposed function type.")
+
+/**
+ * Literal type for testing forwarded calls in constant expressions.
+ */
+struct point
+{
+    int x;
+    constexpr int get() const { return x; }
+    constexpr int scaled(int i) const { return x * i; }
+#if __cplusplus >= 201402L
+    constexpr int bump() { return ++x; }
+#endif
+};
+
+/**
+ * Literal type holding a point by value and by reference, forwarding its constexpr functions.
+ */
+struct shape
+{
+    point p;
+    const point& pr;
+    FORWARD_TO_MEMBER(p, get);
+    FORWARD_TO_MEMBER(p, scaled);
+    FORWARD_TO_MEMBER_AS(pr, get, ref_get);
+    FORWARD_TO_MEMBER_FIELD(p, x, x);
+    FORWARD_TO_MEMBER_FIELD(pr, x, ref_x);
+#if __cplusplus >= 201402L
+    FORWARD_TO_MEMBER(p, bump);
+#endif
+    constexpr shape(int x, const point& other) : p{x}, pr(other) { }
+};
+
+/**
+ * Same as shape except the functions are forwarded with FORWARD_TO_MEMBER_ALL.
+ */
+struct shape_all
+{
+    point p;
+    FORWARD_TO_MEMBER_ALL(p, get, scaled);
+    constexpr shape_all(int x) : p{x} { }
+};
+
+constexpr point origin{3};
+constexpr shape square(2, origin);
+constexpr shape_all circle(4);
+
+// Forwarded calls on const and rvalue objects are constant expressions.
+static_assert(square.get() == 2,                   "Forwarded call should be constexpr.");
+static_assert(square.scaled(3) == 6,               "Forwarded call should be constexpr.");
+static_assert(square.ref_get() == 3,               "Forwarded call should be constexpr.");
+static_assert(shape(5, origin).get() == 5,         "Forwarded call should be constexpr.");
+static_assert(circle.get() == 4,                   "Forwarded call should be constexpr.");
+static_assert(circle.scaled(2) == 8,               "Forwarded call should be constexpr.");
+static_assert(shape_all(6).scaled(2) == 12,        "Forwarded call should be constexpr.");
+static_assert(square.x() == 2,                     "Field accessor should be constexpr.");
+static_assert(square.ref_x() == 3,                 "Field accessor should be constexpr.");
+
+#if __cplusplus >= 201402L
+/**
+ * From C++14 on non-const forwarded functions are constexpr as well.
+ */
+constexpr int bumped()
+{
+    shape s(1, origin);
+    s.bump();
+    return s.bump();
+}
+static_assert(bumped() == 3, "Forwarded call should be constexpr.");
+#endif
+
 int main()
 {
     // Create bar objects of every possible cv qualification.
@@ -202,6 +587,37 @@ int main()
     const bar bc(f);
     const volatile bar bcv(f);
 
+    // Create a FORWARD_TO_MEMBER_ALL wrapper of every member kind and cv qualification.
+    qux q;
+    qux_value    qa(q);  volatile qux_value    qav(q);  const qux_value    qac(q);  const volatile qux_value    qacv(q);
+    qux_ref      qr(q);  volatile qux_ref      qrv(q);  const qux_ref      qrc(q);  const volatile qux_ref      qrcv(q);
+    qux_ptr      qp(q);  volatile qux_ptr      qpv(q);  const qux_ptr      qpc(q);  const volatile qux_ptr      qpcv(q);
+    qux_shared   qs(q);  volatile qux_shared   qsv(q);  const qux_shared   qsc(q);  const volatile qux_shared   qscv(q);
+    qux_observer qo(q);  volatile qux_observer qov(q);  const qux_observer qoc(q);  const volatile qux_observer qocv(q);
+
+    // The exposed functions are noexcept exactly when the member's function is.
+    static_assert( noexcept(b.f_func2(1)),      "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.f_func2(1, 1)),   "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.fr_func2(1)),     "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.fr_func2(1, 1)),  "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.fp_func2(1)),     "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.fp_func2(1, 1)),  "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.fsp_func2(1)),    "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.fsp_func2(1, 1)), "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.fup_func2(1)),    "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.fup_func2(1, 1)), "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.frw_func2(1)),    "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.frw_func2(1, 1)), "Forwarded function should not be noexcept.");
+    static_assert( noexcept(b.fop_func2(1)),    "Forwarded function should be noexcept.");
+    static_assert(!noexcept(b.fop_func2(1, 1)), "Forwarded function should not be noexcept.");
+    static_assert( noexcept(qa.plain()),        "Forwarded function should be noexcept.");
+    static_assert(!noexcept(qa.vol(2)),         "Forwarded function should not be noexcept.");
+    static_assert( noexcept(qp.plain()),        "Forwarded function should be noexcept.");
+    static_assert( noexcept(qs.plain()),        "Forwarded function should be noexcept.");
+    static_assert( noexcept(qo.plain()),        "Forwarded function should be noexcept.");
+    static_assert(!noexcept(qoc.con(1, 2)),     "Forwarded function should not be noexcept.");
+    assert(1 == b.f_func2(1) && 2 == bc.fp_func2(1, 1) && 2 == bc.fsp_func2(1, 1));
+
 // Test all combinations of overload, foo, and bar types. Some combinations are expected to not
 // compile and these are marked as invalid and explored in the "negative test" test script.
           assert(1 == b  .func1(1)               ); // Call plain          method on plain          bar with plain foo.
@@ -588,4 +1004,580 @@ int main()
 //INVALID assert(2 == bcv.fcspcv_func1(1, 1)      ); // Call volatile       method on const volatile bar with const volatile foo shared pointer const.
 //INVALID assert(3 == bcv.fcspcv_func1(1, 1, 1)   ); // Call const          method on const volatile bar with const volatile foo shared pointer const.
 //INVALID assert(4 == bcv.fcspcv_func1(1, 1, 1, 1)); // Call const volatile method on const volatile bar with const volatile foo shared pointer const.
+          assert(1 == b  .fup_func1(1)            ); // Call plain          method on plain          bar with foo unique pointer.
+          assert(2 == b  .fup_func1(1, 1)         ); // Call volatile       method on plain          bar with foo unique pointer.
+          assert(3 == b  .fup_func1(1, 1, 1)      ); // Call const          method on plain          bar with foo unique pointer.
+          assert(4 == b  .fup_func1(1, 1, 1, 1)   ); // Call const volatile method on plain          bar with foo unique pointer.
+//INVALID assert(1 == bv .fup_func1(1)            ); // Call plain          method on volatile       bar with foo unique pointer.
+//INVALID assert(2 == bv .fup_func1(1, 1)         ); // Call volatile       method on volatile       bar with foo unique pointer.
+//INVALID assert(3 == bv .fup_func1(1, 1, 1)      ); // Call const          method on volatile       bar with foo unique pointer.
+//INVALID assert(4 == bv .fup_func1(1, 1, 1, 1)   ); // Call const volatile method on volatile       bar with foo unique pointer.
+//INVALID assert(1 == bc .fup_func1(1)            ); // Call plain          method on const          bar with foo unique pointer.
+//INVALID assert(2 == bc .fup_func1(1, 1)         ); // Call volatile       method on const          bar with foo unique pointer.
+          assert(3 == bc .fup_func1(1, 1, 1)      ); // Call const          method on const          bar with foo unique pointer.
+          assert(4 == bc .fup_func1(1, 1, 1, 1)   ); // Call const volatile method on const          bar with foo unique pointer.
+//INVALID assert(1 == bcv.fup_func1(1)            ); // Call plain          method on const volatile bar with foo unique pointer.
+//INVALID assert(2 == bcv.fup_func1(1, 1)         ); // Call volatile       method on const volatile bar with foo unique pointer.
+//INVALID assert(3 == bcv.fup_func1(1, 1, 1)      ); // Call const          method on const volatile bar with foo unique pointer.
+//INVALID assert(4 == bcv.fup_func1(1, 1, 1, 1)   ); // Call const volatile method on const volatile bar with foo unique pointer.
+//INVALID assert(1 == b  .fupv_func1(1)           ); // Call plain          method on plain          bar with volatile foo unique pointer.
+          assert(2 == b  .fupv_func1(1, 1)        ); // Call volatile       method on plain          bar with volatile foo unique pointer.
+//INVALID assert(3 == b  .fupv_func1(1, 1, 1)     ); // Call const          method on plain          bar with volatile foo unique pointer.
+          assert(4 == b  .fupv_func1(1, 1, 1, 1)  ); // Call const volatile method on plain          bar with volatile foo unique pointer.
+//INVALID assert(1 == bv .fupv_func1(1)           ); // Call plain          method on volatile       bar with volatile foo unique pointer.
+//INVALID assert(2 == bv .fupv_func1(1, 1)        ); // Call volatile       method on volatile       bar with volatile foo unique pointer.
+//INVALID assert(3 == bv .fupv_func1(1, 1, 1)     ); // Call const          method on volatile       bar with volatile foo unique pointer.
+//INVALID assert(4 == bv .fupv_func1(1, 1, 1, 1)  ); // Call const volatile method on volatile       bar with volatile foo unique pointer.
+//INVALID assert(1 == bc .fupv_func1(1)           ); // Call plain          method on const          bar with volatile foo unique pointer.
+//INVALID assert(2 == bc .fupv_func1(1, 1)        ); // Call volatile       method on const          bar with volatile foo unique pointer.
+//INVALID assert(3 == bc .fupv_func1(1, 1, 1)     ); // Call const          method on const          bar with volatile foo unique pointer.
+          assert(4 == bc .fupv_func1(1, 1, 1, 1)  ); // Call const volatile method on const          bar with volatile foo unique pointer.
+//INVALID assert(1 == bcv.fupv_func1(1)           ); // Call plain          method on const volatile bar with volatile foo unique pointer.
+//INVALID assert(2 == bcv.fupv_func1(1, 1)        ); // Call volatile       method on const volatile bar with volatile foo unique pointer.
+//INVALID assert(3 == bcv.fupv_func1(1, 1, 1)     ); // Call const          method on const volatile bar with volatile foo unique pointer.
+//INVALID assert(4 == bcv.fupv_func1(1, 1, 1, 1)  ); // Call const volatile method on const volatile bar with volatile foo unique pointer.
+//INVALID assert(1 == b  .fupc_func1(1)           ); // Call plain          method on plain          bar with const foo unique pointer.
+//INVALID assert(2 == b  .fupc_func1(1, 1)        ); // Call volatile       method on plain          bar with const foo unique pointer.
+          assert(3 == b  .fupc_func1(1, 1, 1)     ); // Call const          method on plain          bar with const foo unique pointer.
+          assert(4 == b  .fupc_func1(1, 1, 1, 1)  ); // Call const volatile method on plain          bar with const foo unique pointer.
+//INVALID assert(1 == bv .fupc_func1(1)           ); // Call plain          method on volatile       bar with const foo unique pointer.
+//INVALID assert(2 == bv .fupc_func1(1, 1)        ); // Call volatile       method on volatile       bar with const foo unique pointer.
+//INVALID assert(3 == bv .fupc_func1(1, 1, 1)     ); // Call const          method on volatile       bar with const foo unique pointer.
+//INVALID assert(4 == bv .fupc_func1(1, 1, 1, 1)  ); // Call const volatile method on volatile       bar with const foo unique pointer.
+//INVALID assert(1 == bc .fupc_func1(1)           ); // Call plain          method on const          bar with const foo unique pointer.
+//INVALID assert(2 == bc .fupc_func1(1, 1)        ); // Call volatile       method on const          bar with const foo unique pointer.
+          assert(3 == bc .fupc_func1(1, 1, 1)     ); // Call const          method on const          bar with const foo unique pointer.
+          assert(4 == bc .fupc_func1(1, 1, 1, 1)  ); // Call const volatile method on const          bar with const foo unique pointer.
+//INVALID assert(1 == bcv.fupc_func1(1)           ); // Call plain          method on const volatile bar with const foo unique pointer.
+//INVALID assert(2 == bcv.fupc_func1(1, 1)        ); // Call volatile       method on const volatile bar with const foo unique pointer.
+//INVALID assert(3 == bcv.fupc_func1(1, 1, 1)     ); // Call const          method on const volatile bar with const foo unique pointer.
+//INVALID assert(4 == bcv.fupc_func1(1, 1, 1, 1)  ); // Call const volatile method on const volatile bar with const foo unique pointer.
+//INVALID assert(1 == b  .fupcv_func1(1)          ); // Call plain          method on plain          bar with const volatile foo unique pointer.
+//INVALID assert(2 == b  .fupcv_func1(1, 1)       ); // Call volatile       method on plain          bar with const volatile foo unique pointer.
+//INVALID assert(3 == b  .fupcv_func1(1, 1, 1)    ); // Call const          method on plain          bar with const volatile foo unique pointer.
+          assert(4 == b  .fupcv_func1(1, 1, 1, 1) ); // Call const volatile method on plain          bar with const volatile foo unique pointer.
+//INVALID assert(1 == bv .fupcv_func1(1)          ); // Call plain          method on volatile       bar with const volatile foo unique pointer.
+//INVALID assert(2 == bv .fupcv_func1(1, 1)       ); // Call volatile       method on volatile       bar with const volatile foo unique pointer.
+//INVALID assert(3 == bv .fupcv_func1(1, 1, 1)    ); // Call const          method on volatile       bar with const volatile foo unique pointer.
+//INVALID assert(4 == bv .fupcv_func1(1, 1, 1, 1) ); // Call const volatile method on volatile       bar with const volatile foo unique pointer.
+//INVALID assert(1 == bc .fupcv_func1(1)          ); // Call plain          method on const          bar with const volatile foo unique pointer.
+//INVALID assert(2 == bc .fupcv_func1(1, 1)       ); // Call volatile       method on const          bar with const volatile foo unique pointer.
+//INVALID assert(3 == bc .fupcv_func1(1, 1, 1)    ); // Call const          method on const          bar with const volatile foo unique pointer.
+          assert(4 == bc .fupcv_func1(1, 1, 1, 1) ); // Call const volatile method on const          bar with const volatile foo unique pointer.
+//INVALID assert(1 == bcv.fupcv_func1(1)          ); // Call plain          method on const volatile bar with const volatile foo unique pointer.
+//INVALID assert(2 == bcv.fupcv_func1(1, 1)       ); // Call volatile       method on const volatile bar with const volatile foo unique pointer.
+//INVALID assert(3 == bcv.fupcv_func1(1, 1, 1)    ); // Call const          method on const volatile bar with const volatile foo unique pointer.
+//INVALID assert(4 == bcv.fupcv_func1(1, 1, 1, 1) ); // Call const volatile method on const volatile bar with const volatile foo unique pointer.
+          assert(1 == b  .frw_func1(1)            ); // Call plain          method on plain          bar with foo reference wrapper.
+          assert(2 == b  .frw_func1(1, 1)         ); // Call volatile       method on plain          bar with foo reference wrapper.
+          assert(3 == b  .frw_func1(1, 1, 1)      ); // Call const          method on plain          bar with foo reference wrapper.
+          assert(4 == b  .frw_func1(1, 1, 1, 1)   ); // Call const volatile method on plain          bar with foo reference wrapper.
+//INVALID assert(1 == bv .frw_func1(1)            ); // Call plain          method on volatile       bar with foo reference wrapper.
+//INVALID assert(2 == bv .frw_func1(1, 1)         ); // Call volatile       method on volatile       bar with foo reference wrapper.
+//INVALID assert(3 == bv .frw_func1(1, 1, 1)      ); // Call const          method on volatile       bar with foo reference wrapper.
+//INVALID assert(4 == bv .frw_func1(1, 1, 1, 1)   ); // Call const volatile method on volatile       bar with foo reference wrapper.
+//INVALID assert(1 == bc .frw_func1(1)            ); // Call plain          method on const          bar with foo reference wrapper.
+//INVALID assert(2 == bc .frw_func1(1, 1)         ); // Call volatile       method on const          bar with foo reference wrapper.
+          assert(3 == bc .frw_func1(1, 1, 1)      ); // Call const          method on const          bar with foo reference wrapper.
+          assert(4 == bc .frw_func1(1, 1, 1, 1)   ); // Call const volatile method on const          bar with foo reference wrapper.
+//INVALID assert(1 == bcv.frw_func1(1)            ); // Call plain          method on const volatile bar with foo reference wrapper.
+//INVALID assert(2 == bcv.frw_func1(1, 1)         ); // Call volatile       method on const volatile bar with foo reference wrapper.
+//INVALID assert(3 == bcv.frw_func1(1, 1, 1)      ); // Call const          method on const volatile bar with foo reference wrapper.
+//INVALID assert(4 == bcv.frw_func1(1, 1, 1, 1)   ); // Call const volatile method on const volatile bar with foo reference wrapper.
+//INVALID assert(1 == b  .frwc_func1(1)           ); // Call plain          method on plain          bar with const foo reference wrapper.
+//INVALID assert(2 == b  .frwc_func1(1, 1)        ); // Call volatile       method on plain          bar with const foo reference wrapper.
+          assert(3 == b  .frwc_func1(1, 1, 1)     ); // Call const          method on plain          bar with const foo reference wrapper.
+          assert(4 == b  .frwc_func1(1, 1, 1, 1)  ); // Call const volatile method on plain          bar with const foo reference wrapper.
+//INVALID assert(1 == bv .frwc_func1(1)           ); // Call plain          method on volatile       bar with const foo reference wrapper.
+//INVALID assert(2 == bv .frwc_func1(1, 1)        ); // Call volatile       method on volatile       bar with const foo reference wrapper.
+//INVALID assert(3 == bv .frwc_func1(1, 1, 1)     ); // Call const          method on volatile       bar with const foo reference wrapper.
+//INVALID assert(4 == bv .frwc_func1(1, 1, 1, 1)  ); // Call const volatile method on volatile       bar with const foo reference wrapper.
+//INVALID assert(1 == bc .frwc_func1(1)           ); // Call plain          method on const          bar with const foo reference wrapper.
+//INVALID assert(2 == bc .frwc_func1(1, 1)        ); // Call volatile       method on const          bar with const foo reference wrapper.
+          assert(3 == bc .frwc_func1(1, 1, 1)     ); // Call const          method on const          bar with const foo reference wrapper.
+          assert(4 == bc .frwc_func1(1, 1, 1, 1)  ); // Call const volatile method on const          bar with const foo reference wrapper.
+//INVALID assert(1 == bcv.frwc_func1(1)           ); // Call plain          method on const volatile bar with const foo reference wrapper.
+//INVALID assert(2 == bcv.frwc_func1(1, 1)        ); // Call volatile       method on const volatile bar with const foo reference wrapper.
+//INVALID assert(3 == bcv.frwc_func1(1, 1, 1)     ); // Call const          method on const volatile bar with const foo reference wrapper.
+//INVALID assert(4 == bcv.frwc_func1(1, 1, 1, 1)  ); // Call const volatile method on const volatile bar with const foo reference wrapper.
+          assert(1 == b  .fop_func1(1)            ); // Call plain          method on plain          bar with foo observer pointer.
+          assert(2 == b  .fop_func1(1, 1)         ); // Call volatile       method on plain          bar with foo observer pointer.
+          assert(3 == b  .fop_func1(1, 1, 1)      ); // Call const          method on plain          bar with foo observer pointer.
+          assert(4 == b  .fop_func1(1, 1, 1, 1)   ); // Call const volatile method on plain          bar with foo observer pointer.
+//INVALID assert(1 == bv .fop_func1(1)            ); // call plain          method on volatile       bar with foo observer pointer.
+          assert(2 == bv .fop_func1(1, 1)         ); // Call volatile       method on volatile       bar with foo observer pointer.
+//INVALID assert(3 == bv .fop_func1(1, 1, 1)      ); // Call const          method on volatile       bar with foo observer pointer.
+          assert(4 == bv .fop_func1(1, 1, 1, 1)   ); // Call const volatile method on volatile       bar with foo observer pointer.
+//INVALID assert(1 == bc .fop_func1(1)            ); // call plain          method on const          bar with foo observer pointer.
+//INVALID assert(2 == bc .fop_func1(1, 1)         ); // Call volatile       method on const          bar with foo observer pointer.
+          assert(3 == bc .fop_func1(1, 1, 1)      ); // Call const          method on const          bar with foo observer pointer.
+          assert(4 == bc .fop_func1(1, 1, 1, 1)   ); // Call const volatile method on const          bar with foo observer pointer.
+//INVALID assert(1 == bcv.fop_func1(1)            ); // call plain          method on const volatile bar with foo observer pointer.
+//INVALID assert(2 == bcv.fop_func1(1, 1)         ); // Call volatile       method on const volatile bar with foo observer pointer.
+//INVALID assert(3 == bcv.fop_func1(1, 1, 1)      ); // Call const          method on const volatile bar with foo observer pointer.
+          assert(4 == bcv.fop_func1(1, 1, 1, 1)   ); // Call const volatile method on const volatile bar with foo observer pointer.
+//INVALID assert(1 == b  .fopc_func1(1)           ); // Call plain          method on plain          bar with const foo observer pointer.
+//INVALID assert(2 == b  .fopc_func1(1, 1)        ); // Call volatile       method on plain          bar with const foo observer pointer.
+          assert(3 == b  .fopc_func1(1, 1, 1)     ); // Call const          method on plain          bar with const foo observer pointer.
+          assert(4 == b  .fopc_func1(1, 1, 1, 1)  ); // Call const volatile method on plain          bar with const foo observer pointer.
+//INVALID assert(1 == bv .fopc_func1(1)           ); // call plain          method on volatile       bar with const foo observer pointer.
+//INVALID assert(2 == bv .fopc_func1(1, 1)        ); // Call volatile       method on volatile       bar with const foo observer pointer.
+//INVALID assert(3 == bv .fopc_func1(1, 1, 1)     ); // Call const          method on volatile       bar with const foo observer pointer.
+          assert(4 == bv .fopc_func1(1, 1, 1, 1)  ); // Call const volatile method on volatile       bar with const foo observer pointer.
+//INVALID assert(1 == bc .fopc_func1(1)           ); // call plain          method on const          bar with const foo observer pointer.
+//INVALID assert(2 == bc .fopc_func1(1, 1)        ); // Call volatile       method on const          bar with const foo observer pointer.
+          assert(3 == bc .fopc_func1(1, 1, 1)     ); // Call const          method on const          bar with const foo observer pointer.
+          assert(4 == bc .fopc_func1(1, 1, 1, 1)  ); // Call const volatile method on const          bar with const foo observer pointer.
+//INVALID assert(1 == bcv.fopc_func1(1)           ); // call plain          method on const volatile bar with const foo observer pointer.
+//INVALID assert(2 == bcv.fopc_func1(1, 1)        ); // Call volatile       method on const volatile bar with const foo observer pointer.
+//INVALID assert(3 == bcv.fopc_func1(1, 1, 1)     ); // Call const          method on const volatile bar with const foo observer pointer.
+          assert(4 == bcv.fopc_func1(1, 1, 1, 1)  ); // Call const volatile method on const volatile bar with const foo observer pointer.
+          assert(1 == qa.plain()      ); // Call plain          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(2 == qa.vol(2)       ); // Call volatile       method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(3 == qa.con(1, 2)    ); // Call const          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(6 == qa.cv(1, 2, 3)  ); // Call const volatile method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(1 == qav.plain()     ); // Call plain          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(2 == qav.vol(2)      ); // Call volatile       method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(3 == qav.con(1, 2)   ); // Call const          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(6 == qav.cv(1, 2, 3) ); // Call const volatile method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(1 == qac.plain()     ); // Call plain          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(2 == qac.vol(2)      ); // Call volatile       method on const          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(3 == qac.con(1, 2)   ); // Call const          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(6 == qac.cv(1, 2, 3) ); // Call const volatile method on const          FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(1 == qacv.plain()    ); // Call plain          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(2 == qacv.vol(2)     ); // Call volatile       method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux value.
+//INVALID assert(3 == qacv.con(1, 2)  ); // Call const          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(6 == qacv.cv(1, 2, 3)); // Call const volatile method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux value.
+          assert(1 == qr.plain()      ); // Call plain          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(2 == qr.vol(2)       ); // Call volatile       method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(3 == qr.con(1, 2)    ); // Call const          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(6 == qr.cv(1, 2, 3)  ); // Call const volatile method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(1 == qrv.plain()     ); // Call plain          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(2 == qrv.vol(2)      ); // Call volatile       method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(3 == qrv.con(1, 2)   ); // Call const          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(6 == qrv.cv(1, 2, 3) ); // Call const volatile method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(1 == qrc.plain()     ); // Call plain          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(2 == qrc.vol(2)      ); // Call volatile       method on const          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(3 == qrc.con(1, 2)   ); // Call const          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(6 == qrc.cv(1, 2, 3) ); // Call const volatile method on const          FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(1 == qrcv.plain()    ); // Call plain          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(2 == qrcv.vol(2)     ); // Call volatile       method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+//INVALID assert(3 == qrcv.con(1, 2)  ); // Call const          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(6 == qrcv.cv(1, 2, 3)); // Call const volatile method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux reference.
+          assert(1 == qp.plain()      ); // Call plain          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(2 == qp.vol(2)       ); // Call volatile       method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(3 == qp.con(1, 2)    ); // Call const          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(6 == qp.cv(1, 2, 3)  ); // Call const volatile method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(1 == qpv.plain()     ); // Call plain          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(2 == qpv.vol(2)      ); // Call volatile       method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(3 == qpv.con(1, 2)   ); // Call const          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(6 == qpv.cv(1, 2, 3) ); // Call const volatile method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(1 == qpc.plain()     ); // Call plain          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(2 == qpc.vol(2)      ); // Call volatile       method on const          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(3 == qpc.con(1, 2)   ); // Call const          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(6 == qpc.cv(1, 2, 3) ); // Call const volatile method on const          FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(1 == qpcv.plain()    ); // Call plain          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(2 == qpcv.vol(2)     ); // Call volatile       method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+//INVALID assert(3 == qpcv.con(1, 2)  ); // Call const          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(6 == qpcv.cv(1, 2, 3)); // Call const volatile method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux pointer.
+          assert(1 == qs.plain()      ); // Call plain          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(2 == qs.vol(2)       ); // Call volatile       method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(3 == qs.con(1, 2)    ); // Call const          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(6 == qs.cv(1, 2, 3)  ); // Call const volatile method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(1 == qsv.plain()     ); // Call plain          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(2 == qsv.vol(2)      ); // Call volatile       method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(3 == qsv.con(1, 2)   ); // Call const          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(6 == qsv.cv(1, 2, 3) ); // Call const volatile method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(1 == qsc.plain()     ); // Call plain          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(2 == qsc.vol(2)      ); // Call volatile       method on const          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(3 == qsc.con(1, 2)   ); // Call const          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(6 == qsc.cv(1, 2, 3) ); // Call const volatile method on const          FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(1 == qscv.plain()    ); // Call plain          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(2 == qscv.vol(2)     ); // Call volatile       method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(3 == qscv.con(1, 2)  ); // Call const          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+//INVALID assert(6 == qscv.cv(1, 2, 3)); // Call const volatile method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux shared pointer.
+          assert(1 == qo.plain()      ); // Call plain          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(2 == qo.vol(2)       ); // Call volatile       method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(3 == qo.con(1, 2)    ); // Call const          method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(6 == qo.cv(1, 2, 3)  ); // Call const volatile method on plain          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(1 == qov.plain()     ); // Call plain          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(2 == qov.vol(2)      ); // Call volatile       method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(3 == qov.con(1, 2)   ); // Call const          method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(6 == qov.cv(1, 2, 3) ); // Call const volatile method on volatile       FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(1 == qoc.plain()     ); // Call plain          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(2 == qoc.vol(2)      ); // Call volatile       method on const          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(3 == qoc.con(1, 2)   ); // Call const          method on const          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(6 == qoc.cv(1, 2, 3) ); // Call const volatile method on const          FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(1 == qocv.plain()    ); // Call plain          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(2 == qocv.vol(2)     ); // Call volatile       method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+//INVALID assert(3 == qocv.con(1, 2)  ); // Call const          method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+          assert(6 == qocv.cv(1, 2, 3)); // Call const volatile method on const volatile FORWARD_TO_MEMBER_ALL wrapper with qux observer pointer.
+
+    // FORWARD_TO_MEMBER_ALL calls the same overload as FORWARD_TO_MEMBER_AS, the const one as
+    // classified, whatever the kind of member: the object is made const through a value, a pointer
+    // and every kind of pointer-like member alike.
+    twin t;
+    twin_value    tv(t);  const twin_value    tvc(t);
+    twin_ptr      tp(t);  const twin_ptr      tpc(t);
+    twin_shared   ts(t);  const twin_shared   tsc(t);
+    twin_unique   tu(t);  const twin_unique   tuc(t);
+    twin_ref      tr(t);  const twin_ref      trc(t);
+    twin_observer to(t);  const twin_observer toc(t);
+    assert(2 == tv.get() && 2 == tvc.get() && tv.single_get() == tv.get() && tvc.single_get() == tvc.get());
+    assert(2 == tp.get() && 2 == tpc.get() && tp.single_get() == tp.get() && tpc.single_get() == tpc.get());
+    assert(2 == ts.get() && 2 == tsc.get() && ts.single_get() == ts.get() && tsc.single_get() == tsc.get());
+    assert(2 == tu.get() && 2 == tuc.get() && tu.single_get() == tu.get() && tuc.single_get() == tuc.get());
+    assert(2 == tr.get() && 2 == trc.get() && tr.single_get() == tr.get() && trc.single_get() == trc.get());
+    assert(2 == to.get() && 2 == toc.get() && to.single_get() == to.get() && toc.single_get() == toc.get());
+
+    // Create a FORWARD_TO_MEMBER_PATH wrapper of every cv qualification.
+    chain ch(f);  volatile chain chv(f);  const chain chc(f);  const volatile chain chcv(f);
+    static_assert( noexcept(ch.l_f_func2(1)),        "Forwarded function should be noexcept.");
+    static_assert(!noexcept(ch.l_f_func2(1, 1)),     "Forwarded function should not be noexcept.");
+    static_assert( noexcept(ch.lsp_fp_func2(1)),     "Forwarded function should be noexcept.");
+    assert(2 == chc.l_f_func2(1, 1) && 2 == chc.lsp_fp_func2(1, 1));
+    assert(1 == chain(f).l_f(1) && 3 == chain(f).lsp_fsp(1, 1, 1) && 1 == std::move(ch).lp_f(1));
+
+// Test the overloads of foo along every path on chain objects of every cv qualification. The cv
+// qualification of the object is carried along the whole path, so only the const overloads are
+// reached through a pointer to const and no path through a shared pointer can be volatile.
+          assert(1 == ch  .l_f(1)             ); // Call plain          method on plain          chain through value then value.
+          assert(2 == ch  .l_f(1, 1)          ); // Call volatile       method on plain          chain through value then value.
+          assert(3 == ch  .l_f(1, 1, 1)       ); // Call const          method on plain          chain through value then value.
+          assert(4 == ch  .l_f(1, 1, 1, 1)    ); // Call const volatile method on plain          chain through value then value.
+//INVALID assert(1 == chv .l_f(1)             ); // Call plain          method on volatile       chain through value then value.
+          assert(2 == chv .l_f(1, 1)          ); // Call volatile       method on volatile       chain through value then value.
+//INVALID assert(3 == chv .l_f(1, 1, 1)       ); // Call const          method on volatile       chain through value then value.
+          assert(4 == chv .l_f(1, 1, 1, 1)    ); // Call const volatile method on volatile       chain through value then value.
+//INVALID assert(1 == chc .l_f(1)             ); // Call plain          method on const          chain through value then value.
+//INVALID assert(2 == chc .l_f(1, 1)          ); // Call volatile       method on const          chain through value then value.
+          assert(3 == chc .l_f(1, 1, 1)       ); // Call const          method on const          chain through value then value.
+          assert(4 == chc .l_f(1, 1, 1, 1)    ); // Call const volatile method on const          chain through value then value.
+//INVALID assert(1 == chcv.l_f(1)             ); // Call plain          method on const volatile chain through value then value.
+//INVALID assert(2 == chcv.l_f(1, 1)          ); // Call volatile       method on const volatile chain through value then value.
+//INVALID assert(3 == chcv.l_f(1, 1, 1)       ); // Call const          method on const volatile chain through value then value.
+          assert(4 == chcv.l_f(1, 1, 1, 1)    ); // Call const volatile method on const volatile chain through value then value.
+          assert(1 == ch  .l_fp(1)            ); // Call plain          method on plain          chain through value then pointer.
+          assert(2 == ch  .l_fp(1, 1)         ); // Call volatile       method on plain          chain through value then pointer.
+          assert(3 == ch  .l_fp(1, 1, 1)      ); // Call const          method on plain          chain through value then pointer.
+          assert(4 == ch  .l_fp(1, 1, 1, 1)   ); // Call const volatile method on plain          chain through value then pointer.
+//INVALID assert(1 == chv .l_fp(1)            ); // Call plain          method on volatile       chain through value then pointer.
+          assert(2 == chv .l_fp(1, 1)         ); // Call volatile       method on volatile       chain through value then pointer.
+//INVALID assert(3 == chv .l_fp(1, 1, 1)      ); // Call const          method on volatile       chain through value then pointer.
+          assert(4 == chv .l_fp(1, 1, 1, 1)   ); // Call const volatile method on volatile       chain through value then pointer.
+//INVALID assert(1 == chc .l_fp(1)            ); // Call plain          method on const          chain through value then pointer.
+//INVALID assert(2 == chc .l_fp(1, 1)         ); // Call volatile       method on const          chain through value then pointer.
+          assert(3 == chc .l_fp(1, 1, 1)      ); // Call const          method on const          chain through value then pointer.
+          assert(4 == chc .l_fp(1, 1, 1, 1)   ); // Call const volatile method on const          chain through value then pointer.
+//INVALID assert(1 == chcv.l_fp(1)            ); // Call plain          method on const volatile chain through value then pointer.
+//INVALID assert(2 == chcv.l_fp(1, 1)         ); // Call volatile       method on const volatile chain through value then pointer.
+//INVALID assert(3 == chcv.l_fp(1, 1, 1)      ); // Call const          method on const volatile chain through value then pointer.
+          assert(4 == chcv.l_fp(1, 1, 1, 1)   ); // Call const volatile method on const volatile chain through value then pointer.
+          assert(1 == ch  .l_fsp(1)           ); // Call plain          method on plain          chain through value then shared pointer.
+          assert(2 == ch  .l_fsp(1, 1)        ); // Call volatile       method on plain          chain through value then shared pointer.
+          assert(3 == ch  .l_fsp(1, 1, 1)     ); // Call const          method on plain          chain through value then shared pointer.
+          assert(4 == ch  .l_fsp(1, 1, 1, 1)  ); // Call const volatile method on plain          chain through value then shared pointer.
+//INVALID assert(1 == chv .l_fsp(1)           ); // Call plain          method on volatile       chain through value then shared pointer.
+//INVALID assert(2 == chv .l_fsp(1, 1)        ); // Call volatile       method on volatile       chain through value then shared pointer.
+//INVALID assert(3 == chv .l_fsp(1, 1, 1)     ); // Call const          method on volatile       chain through value then shared pointer.
+//INVALID assert(4 == chv .l_fsp(1, 1, 1, 1)  ); // Call const volatile method on volatile       chain through value then shared pointer.
+//INVALID assert(1 == chc .l_fsp(1)           ); // Call plain          method on const          chain through value then shared pointer.
+//INVALID assert(2 == chc .l_fsp(1, 1)        ); // Call volatile       method on const          chain through value then shared pointer.
+          assert(3 == chc .l_fsp(1, 1, 1)     ); // Call const          method on const          chain through value then shared pointer.
+          assert(4 == chc .l_fsp(1, 1, 1, 1)  ); // Call const volatile method on const          chain through value then shared pointer.
+//INVALID assert(1 == chcv.l_fsp(1)           ); // Call plain          method on const volatile chain through value then shared pointer.
+//INVALID assert(2 == chcv.l_fsp(1, 1)        ); // Call volatile       method on const volatile chain through value then shared pointer.
+//INVALID assert(3 == chcv.l_fsp(1, 1, 1)     ); // Call const          method on const volatile chain through value then shared pointer.
+//INVALID assert(4 == chcv.l_fsp(1, 1, 1, 1)  ); // Call const volatile method on const volatile chain through value then shared pointer.
+          assert(1 == ch  .lp_f(1)            ); // Call plain          method on plain          chain through pointer then value.
+          assert(2 == ch  .lp_f(1, 1)         ); // Call volatile       method on plain          chain through pointer then value.
+          assert(3 == ch  .lp_f(1, 1, 1)      ); // Call const          method on plain          chain through pointer then value.
+          assert(4 == ch  .lp_f(1, 1, 1, 1)   ); // Call const volatile method on plain          chain through pointer then value.
+//INVALID assert(1 == chv .lp_f(1)            ); // Call plain          method on volatile       chain through pointer then value.
+          assert(2 == chv .lp_f(1, 1)         ); // Call volatile       method on volatile       chain through pointer then value.
+//INVALID assert(3 == chv .lp_f(1, 1, 1)      ); // Call const          method on volatile       chain through pointer then value.
+          assert(4 == chv .lp_f(1, 1, 1, 1)   ); // Call const volatile method on volatile       chain through pointer then value.
+//INVALID assert(1 == chc .lp_f(1)            ); // Call plain          method on const          chain through pointer then value.
+//INVALID assert(2 == chc .lp_f(1, 1)         ); // Call volatile       method on const          chain through pointer then value.
+          assert(3 == chc .lp_f(1, 1, 1)      ); // Call const          method on const          chain through pointer then value.
+          assert(4 == chc .lp_f(1, 1, 1, 1)   ); // Call const volatile method on const          chain through pointer then value.
+//INVALID assert(1 == chcv.lp_f(1)            ); // Call plain          method on const volatile chain through pointer then value.
+//INVALID assert(2 == chcv.lp_f(1, 1)         ); // Call volatile       method on const volatile chain through pointer then value.
+//INVALID assert(3 == chcv.lp_f(1, 1, 1)      ); // Call const          method on const volatile chain through pointer then value.
+          assert(4 == chcv.lp_f(1, 1, 1, 1)   ); // Call const volatile method on const volatile chain through pointer then value.
+          assert(1 == ch  .lp_fp(1)           ); // Call plain          method on plain          chain through pointer then pointer.
+          assert(2 == ch  .lp_fp(1, 1)        ); // Call volatile       method on plain          chain through pointer then pointer.
+          assert(3 == ch  .lp_fp(1, 1, 1)     ); // Call const          method on plain          chain through pointer then pointer.
+          assert(4 == ch  .lp_fp(1, 1, 1, 1)  ); // Call const volatile method on plain          chain through pointer then pointer.
+//INVALID assert(1 == chv .lp_fp(1)           ); // Call plain          method on volatile       chain through pointer then pointer.
+          assert(2 == chv .lp_fp(1, 1)        ); // Call volatile       method on volatile       chain through pointer then pointer.
+//INVALID assert(3 == chv .lp_fp(1, 1, 1)     ); // Call const          method on volatile       chain through pointer then pointer.
+          assert(4 == chv .lp_fp(1, 1, 1, 1)  ); // Call const volatile method on volatile       chain through pointer then pointer.
+//INVALID assert(1 == chc .lp_fp(1)           ); // Call plain          method on const          chain through pointer then pointer.
+//INVALID assert(2 == chc .lp_fp(1, 1)        ); // Call volatile       method on const          chain through pointer then pointer.
+          assert(3 == chc .lp_fp(1, 1, 1)     ); // Call const          method on const          chain through pointer then pointer.
+          assert(4 == chc .lp_fp(1, 1, 1, 1)  ); // Call const volatile method on const          chain through pointer then pointer.
+//INVALID assert(1 == chcv.lp_fp(1)           ); // Call plain          method on const volatile chain through pointer then pointer.
+//INVALID assert(2 == chcv.lp_fp(1, 1)        ); // Call volatile       method on const volatile chain through pointer then pointer.
+//INVALID assert(3 == chcv.lp_fp(1, 1, 1)     ); // Call const          method on const volatile chain through pointer then pointer.
+          assert(4 == chcv.lp_fp(1, 1, 1, 1)  ); // Call const volatile method on const volatile chain through pointer then pointer.
+          assert(1 == ch  .lp_fsp(1)          ); // Call plain          method on plain          chain through pointer then shared pointer.
+          assert(2 == ch  .lp_fsp(1, 1)       ); // Call volatile       method on plain          chain through pointer then shared pointer.
+          assert(3 == ch  .lp_fsp(1, 1, 1)    ); // Call const          method on plain          chain through pointer then shared pointer.
+          assert(4 == ch  .lp_fsp(1, 1, 1, 1) ); // Call const volatile method on plain          chain through pointer then shared pointer.
+//INVALID assert(1 == chv .lp_fsp(1)          ); // Call plain          method on volatile       chain through pointer then shared pointer.
+//INVALID assert(2 == chv .lp_fsp(1, 1)       ); // Call volatile       method on volatile       chain through pointer then shared pointer.
+//INVALID assert(3 == chv .lp_fsp(1, 1, 1)    ); // Call const          method on volatile       chain through pointer then shared pointer.
+//INVALID assert(4 == chv .lp_fsp(1, 1, 1, 1) ); // Call const volatile method on volatile       chain through pointer then shared pointer.
+//INVALID assert(1 == chc .lp_fsp(1)          ); // Call plain          method on const          chain through pointer then shared pointer.
+//INVALID assert(2 == chc .lp_fsp(1, 1)       ); // Call volatile       method on const          chain through pointer then shared pointer.
+          assert(3 == chc .lp_fsp(1, 1, 1)    ); // Call const          method on const          chain through pointer then shared pointer.
+          assert(4 == chc .lp_fsp(1, 1, 1, 1) ); // Call const volatile method on const          chain through pointer then shared pointer.
+//INVALID assert(1 == chcv.lp_fsp(1)          ); // Call plain          method on const volatile chain through pointer then shared pointer.
+//INVALID assert(2 == chcv.lp_fsp(1, 1)       ); // Call volatile       method on const volatile chain through pointer then shared pointer.
+//INVALID assert(3 == chcv.lp_fsp(1, 1, 1)    ); // Call const          method on const volatile chain through pointer then shared pointer.
+//INVALID assert(4 == chcv.lp_fsp(1, 1, 1, 1) ); // Call const volatile method on const volatile chain through pointer then shared pointer.
+          assert(1 == ch  .lsp_f(1)           ); // Call plain          method on plain          chain through shared pointer then value.
+          assert(2 == ch  .lsp_f(1, 1)        ); // Call volatile       method on plain          chain through shared pointer then value.
+          assert(3 == ch  .lsp_f(1, 1, 1)     ); // Call const          method on plain          chain through shared pointer then value.
+          assert(4 == ch  .lsp_f(1, 1, 1, 1)  ); // Call const volatile method on plain          chain through shared pointer then value.
+//INVALID assert(1 == chv .lsp_f(1)           ); // Call plain          method on volatile       chain through shared pointer then value.
+//INVALID assert(2 == chv .lsp_f(1, 1)        ); // Call volatile       method on volatile       chain through shared pointer then value.
+//INVALID assert(3 == chv .lsp_f(1, 1, 1)     ); // Call const          method on volatile       chain through shared pointer then value.
+//INVALID assert(4 == chv .lsp_f(1, 1, 1, 1)  ); // Call const volatile method on volatile       chain through shared pointer then value.
+//INVALID assert(1 == chc .lsp_f(1)           ); // Call plain          method on const          chain through shared pointer then value.
+//INVALID assert(2 == chc .lsp_f(1, 1)        ); // Call volatile       method on const          chain through shared pointer then value.
+          assert(3 == chc .lsp_f(1, 1, 1)     ); // Call const          method on const          chain through shared pointer then value.
+          assert(4 == chc .lsp_f(1, 1, 1, 1)  ); // Call const volatile method on const          chain through shared pointer then value.
+//INVALID assert(1 == chcv.lsp_f(1)           ); // Call plain          method on const volatile chain through shared pointer then value.
+//INVALID assert(2 == chcv.lsp_f(1, 1)        ); // Call volatile       method on const volatile chain through shared pointer then value.
+//INVALID assert(3 == chcv.lsp_f(1, 1, 1)     ); // Call const          method on const volatile chain through shared pointer then value.
+//INVALID assert(4 == chcv.lsp_f(1, 1, 1, 1)  ); // Call const volatile method on const volatile chain through shared pointer then value.
+          assert(1 == ch  .lsp_fp(1)          ); // Call plain          method on plain          chain through shared pointer then pointer.
+          assert(2 == ch  .lsp_fp(1, 1)       ); // Call volatile       method on plain          chain through shared pointer then pointer.
+          assert(3 == ch  .lsp_fp(1, 1, 1)    ); // Call const          method on plain          chain through shared pointer then pointer.
+          assert(4 == ch  .lsp_fp(1, 1, 1, 1) ); // Call const volatile method on plain          chain through shared pointer then pointer.
+//INVALID assert(1 == chv .lsp_fp(1)          ); // Call plain          method on volatile       chain through shared pointer then pointer.
+//INVALID assert(2 == chv .lsp_fp(1, 1)       ); // Call volatile       method on volatile       chain through shared pointer then pointer.
+//INVALID assert(3 == chv .lsp_fp(1, 1, 1)    ); // Call const          method on volatile       chain through shared pointer then pointer.
+//INVALID assert(4 == chv .lsp_fp(1, 1, 1, 1) ); // Call const volatile method on volatile       chain through shared pointer then pointer.
+//INVALID assert(1 == chc .lsp_fp(1)          ); // Call plain          method on const          chain through shared pointer then pointer.
+//INVALID assert(2 == chc .lsp_fp(1, 1)       ); // Call volatile       method on const          chain through shared pointer then pointer.
+          assert(3 == chc .lsp_fp(1, 1, 1)    ); // Call const          method on const          chain through shared pointer then pointer.
+          assert(4 == chc .lsp_fp(1, 1, 1, 1) ); // Call const volatile method on const          chain through shared pointer then pointer.
+//INVALID assert(1 == chcv.lsp_fp(1)          ); // Call plain          method on const volatile chain through shared pointer then pointer.
+//INVALID assert(2 == chcv.lsp_fp(1, 1)       ); // Call volatile       method on const volatile chain through shared pointer then pointer.
+//INVALID assert(3 == chcv.lsp_fp(1, 1, 1)    ); // Call const          method on const volatile chain through shared pointer then pointer.
+//INVALID assert(4 == chcv.lsp_fp(1, 1, 1, 1) ); // Call const volatile method on const volatile chain through shared pointer then pointer.
+          assert(1 == ch  .lsp_fsp(1)         ); // Call plain          method on plain          chain through shared pointer then shared pointer.
+          assert(2 == ch  .lsp_fsp(1, 1)      ); // Call volatile       method on plain          chain through shared pointer then shared pointer.
+          assert(3 == ch  .lsp_fsp(1, 1, 1)   ); // Call const          method on plain          chain through shared pointer then shared pointer.
+          assert(4 == ch  .lsp_fsp(1, 1, 1, 1)); // Call const volatile method on plain          chain through shared pointer then shared pointer.
+//INVALID assert(1 == chv .lsp_fsp(1)         ); // Call plain          method on volatile       chain through shared pointer then shared pointer.
+//INVALID assert(2 == chv .lsp_fsp(1, 1)      ); // Call volatile       method on volatile       chain through shared pointer then shared pointer.
+//INVALID assert(3 == chv .lsp_fsp(1, 1, 1)   ); // Call const          method on volatile       chain through shared pointer then shared pointer.
+//INVALID assert(4 == chv .lsp_fsp(1, 1, 1, 1)); // Call const volatile method on volatile       chain through shared pointer then shared pointer.
+//INVALID assert(1 == chc .lsp_fsp(1)         ); // Call plain          method on const          chain through shared pointer then shared pointer.
+//INVALID assert(2 == chc .lsp_fsp(1, 1)      ); // Call volatile       method on const          chain through shared pointer then shared pointer.
+          assert(3 == chc .lsp_fsp(1, 1, 1)   ); // Call const          method on const          chain through shared pointer then shared pointer.
+          assert(4 == chc .lsp_fsp(1, 1, 1, 1)); // Call const volatile method on const          chain through shared pointer then shared pointer.
+//INVALID assert(1 == chcv.lsp_fsp(1)         ); // Call plain          method on const volatile chain through shared pointer then shared pointer.
+//INVALID assert(2 == chcv.lsp_fsp(1, 1)      ); // Call volatile       method on const volatile chain through shared pointer then shared pointer.
+//INVALID assert(3 == chcv.lsp_fsp(1, 1, 1)   ); // Call const          method on const volatile chain through shared pointer then shared pointer.
+//INVALID assert(4 == chcv.lsp_fsp(1, 1, 1, 1)); // Call const volatile method on const volatile chain through shared pointer then shared pointer.
+//INVALID assert(1 == ch  .lcp_fp(1)          ); // Call plain          method on plain          chain through pointer to const then pointer.
+//INVALID assert(2 == ch  .lcp_fp(1, 1)       ); // Call volatile       method on plain          chain through pointer to const then pointer.
+          assert(3 == ch  .lcp_fp(1, 1, 1)    ); // Call const          method on plain          chain through pointer to const then pointer.
+          assert(4 == ch  .lcp_fp(1, 1, 1, 1) ); // Call const volatile method on plain          chain through pointer to const then pointer.
+//INVALID assert(1 == chv .lcp_fp(1)          ); // Call plain          method on volatile       chain through pointer to const then pointer.
+//INVALID assert(2 == chv .lcp_fp(1, 1)       ); // Call volatile       method on volatile       chain through pointer to const then pointer.
+//INVALID assert(3 == chv .lcp_fp(1, 1, 1)    ); // Call const          method on volatile       chain through pointer to const then pointer.
+          assert(4 == chv .lcp_fp(1, 1, 1, 1) ); // Call const volatile method on volatile       chain through pointer to const then pointer.
+//INVALID assert(1 == chc .lcp_fp(1)          ); // Call plain          method on const          chain through pointer to const then pointer.
+//INVALID assert(2 == chc .lcp_fp(1, 1)       ); // Call volatile       method on const          chain through pointer to const then pointer.
+          assert(3 == chc .lcp_fp(1, 1, 1)    ); // Call const          method on const          chain through pointer to const then pointer.
+          assert(4 == chc .lcp_fp(1, 1, 1, 1) ); // Call const volatile method on const          chain through pointer to const then pointer.
+//INVALID assert(1 == chcv.lcp_fp(1)          ); // Call plain          method on const volatile chain through pointer to const then pointer.
+//INVALID assert(2 == chcv.lcp_fp(1, 1)       ); // Call volatile       method on const volatile chain through pointer to const then pointer.
+//INVALID assert(3 == chcv.lcp_fp(1, 1, 1)    ); // Call const          method on const volatile chain through pointer to const then pointer.
+          assert(4 == chcv.lcp_fp(1, 1, 1, 1) ); // Call const volatile method on const volatile chain through pointer to const then pointer.
+          assert(1 == ch  .lp_next_fp(1)      ); // Call plain          method on plain          chain through pointer, pointer, pointer then pointer.
+          assert(2 == ch  .lp_next_fp(1, 1)   ); // Call volatile       method on plain          chain through pointer, pointer, pointer then pointer.
+          assert(3 == ch  .lp_next_fp(1, 1, 1)); // Call const          method on plain          chain through pointer, pointer, pointer then pointer.
+          assert(4 == ch  .lp_next_fp(1, 1, 1, 1)); // Call const volatile method on plain          chain through pointer, pointer, pointer then pointer.
+//INVALID assert(1 == chv .lp_next_fp(1)      ); // Call plain          method on volatile       chain through pointer, pointer, pointer then pointer.
+          assert(2 == chv .lp_next_fp(1, 1)   ); // Call volatile       method on volatile       chain through pointer, pointer, pointer then pointer.
+//INVALID assert(3 == chv .lp_next_fp(1, 1, 1)); // Call const          method on volatile       chain through pointer, pointer, pointer then pointer.
+          assert(4 == chv .lp_next_fp(1, 1, 1, 1)); // Call const volatile method on volatile       chain through pointer, pointer, pointer then pointer.
+//INVALID assert(1 == chc .lp_next_fp(1)      ); // Call plain          method on const          chain through pointer, pointer, pointer then pointer.
+//INVALID assert(2 == chc .lp_next_fp(1, 1)   ); // Call volatile       method on const          chain through pointer, pointer, pointer then pointer.
+          assert(3 == chc .lp_next_fp(1, 1, 1)); // Call const          method on const          chain through pointer, pointer, pointer then pointer.
+          assert(4 == chc .lp_next_fp(1, 1, 1, 1)); // Call const volatile method on const          chain through pointer, pointer, pointer then pointer.
+//INVALID assert(1 == chcv.lp_next_fp(1)      ); // Call plain          method on const volatile chain through pointer, pointer, pointer then pointer.
+//INVALID assert(2 == chcv.lp_next_fp(1, 1)   ); // Call volatile       method on const volatile chain through pointer, pointer, pointer then pointer.
+//INVALID assert(3 == chcv.lp_next_fp(1, 1, 1)); // Call const          method on const volatile chain through pointer, pointer, pointer then pointer.
+          assert(4 == chcv.lp_next_fp(1, 1, 1, 1)); // Call const volatile method on const volatile chain through pointer, pointer, pointer then pointer.
+
+    // Create a wrapper with a ref-qualified function of every member kind, and const and volatile
+    // ones where the member is a value.
+    buffer u;
+    buffer_value    ua(u);  const buffer_value    uac(u);  volatile buffer_value    uav(u);
+    buffer_value_as us(u);  const buffer_value_as usc(u);  volatile buffer_value_as usv(u);
+    buffer_ref      ur(u);
+    buffer_ptr      up(u);
+    buffer_unique   uu(u);
+
+// Test each value category of wrapper. Only a value member is called as an rvalue when the wrapper is
+// one, the other kinds of member always get called as an lvalue.
+          assert(1 == ua.take()                      ); // Call const & method on lvalue   FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(2 == std::move(ua).take()           ); // Call && method on rvalue        FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(1 == std::move(uac).take()          ); // Call const & method on const rvalue FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(3 == ua.peek(3)                     ); // Call & method on lvalue         FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+//INVALID assert(3 == std::move(ua).peek(3)          ); // Call & method on rvalue         FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+//INVALID assert(3 == ua.drop(1, 2)                  ); // Call const && method on lvalue  FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(3 == std::move(ua).drop(1, 2)       ); // Call const && method on rvalue  FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(3 == std::move(uac).drop(1, 2)      ); // Call const && method on const rvalue FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+//INVALID assert(6 == uav.wipe(1, 2, 3)              ); // Call volatile && method on volatile lvalue FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(6 == std::move(uav).wipe(1, 2, 3)   ); // Call volatile && method on volatile rvalue FORWARD_TO_MEMBER_ALL wrapper with buffer value.
+          assert(1 == us.take()                      ); // Call const & method on lvalue   FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(2 == std::move(us).take()           ); // Call && method on rvalue        FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(1 == std::move(usc).take()          ); // Call const & method on const rvalue FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(3 == us.peek(3)                     ); // Call & method on lvalue         FORWARD_TO_MEMBER wrapper with buffer value.
+//INVALID assert(3 == std::move(us).peek(3)          ); // Call & method on rvalue         FORWARD_TO_MEMBER wrapper with buffer value.
+//INVALID assert(3 == us.drop(1, 2)                  ); // Call const && method on lvalue  FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(3 == std::move(us).drop(1, 2)       ); // Call const && method on rvalue  FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(3 == std::move(usc).drop(1, 2)      ); // Call const && method on const rvalue FORWARD_TO_MEMBER wrapper with buffer value.
+//INVALID assert(6 == usv.wipe(1, 2, 3)              ); // Call volatile && method on volatile lvalue FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(6 == std::move(usv).wipe(1, 2, 3)   ); // Call volatile && method on volatile rvalue FORWARD_TO_MEMBER wrapper with buffer value.
+          assert(1 == ur.take()                      ); // Call const & method on lvalue   FORWARD_TO_MEMBER_ALL wrapper with buffer reference.
+          assert(1 == std::move(ur).take()           ); // Call const & method on rvalue   FORWARD_TO_MEMBER_ALL wrapper with buffer reference.
+          assert(3 == std::move(ur).peek(3)          ); // Call & method on rvalue         FORWARD_TO_MEMBER_ALL wrapper with buffer reference.
+//INVALID assert(3 == std::move(ur).drop(1, 2)       ); // Call const && method on rvalue  FORWARD_TO_MEMBER_ALL wrapper with buffer reference.
+          assert(1 == std::move(up).take()           ); // Call const & method on rvalue   FORWARD_TO_MEMBER_ALL wrapper with buffer pointer.
+          assert(3 == std::move(up).peek(3)          ); // Call & method on rvalue         FORWARD_TO_MEMBER_ALL wrapper with buffer pointer.
+//INVALID assert(3 == std::move(up).drop(1, 2)       ); // Call const && method on rvalue  FORWARD_TO_MEMBER_ALL wrapper with buffer pointer.
+          assert(1 == std::move(uu).take()           ); // Call const & method on rvalue   FORWARD_TO_MEMBER_ALL wrapper with buffer unique pointer.
+          assert(3 == std::move(uu).peek(3)          ); // Call & method on rvalue         FORWARD_TO_MEMBER_ALL wrapper with buffer unique pointer.
+//INVALID assert(3 == std::move(uu).drop(1, 2)       ); // Call const && method on rvalue  FORWARD_TO_MEMBER_ALL wrapper with buffer unique pointer.
+
+    // Functions that are not ref-qualified can be called on both value categories.
+    assert(1 == std::move(b).func1(1) && 3 == std::move(bc).func1(1, 1, 1));
+    assert(1 == std::move(b).fp_func1(1) && 2 == std::move(qa).vol(2));
+
+    // Create a FORWARD_TO_MEMBER_FIELD wrapper of every member kind.
+    record rec = {tally(1), {2, 3}};
+    record_value    ra(rec);  const record_value    rac(rec);
+    record_ref      rr(rec);  const record_ref      rrc(rec);
+    record_ptr      rp(rec);  const record_ptr      rpc(rec);
+    record_ptrc     rq(rec);
+    record_shared   rs(rec);  const record_shared   rsc(rec);
+    record_sharedc  rt(rec);
+    record_unique   ru(rec);
+    record_observer ro(rec);
+
+    // Fields are const references on const wrappers and references on non-const lvalues. On
+    // rvalues they are moved out of a value member and references through the other kinds.
+    TEST_EXPOSED_TYPE(ra.total(),             tally&);
+    TEST_EXPOSED_TYPE(rac.total(),            const tally&);
+    TEST_EXPOSED_TYPE(std::move(ra).total(),  tally);
+    TEST_EXPOSED_TYPE(std::move(rac).total(), const tally&);
+    TEST_EXPOSED_TYPE(std::move(ra).slots(),  int(&&)[2]);
+    TEST_EXPOSED_TYPE(rr.total(),             tally&);
+    TEST_EXPOSED_TYPE(rrc.total(),            const tally&);
+    TEST_EXPOSED_TYPE(std::move(rr).total(),  tally&);
+    TEST_EXPOSED_TYPE(rp.total(),             tally&);
+    TEST_EXPOSED_TYPE(rpc.total(),            const tally&);
+    TEST_EXPOSED_TYPE(std::move(rp).total(),  tally&);
+    TEST_EXPOSED_TYPE(rq.total(),             const tally&);
+    TEST_EXPOSED_TYPE(std::move(rq).total(),  const tally&);
+    TEST_EXPOSED_TYPE(rs.total(),             tally&);
+    TEST_EXPOSED_TYPE(rsc.total(),            const tally&);
+    TEST_EXPOSED_TYPE(std::move(rs).total(),  tally&);
+    TEST_EXPOSED_TYPE(rt.total(),             const tally&);
+    TEST_EXPOSED_TYPE(std::move(ru).total(),  tally&);
+    TEST_EXPOSED_TYPE(ro.slots(),             int(&)[2]);
+    static_assert(noexcept(std::move(ra).total()), "Field accessor should be noexcept.");
+    static_assert(noexcept(rs.total()),            "Field accessor should be noexcept.");
+
+    // Getting a field through any kind of member copies nothing and refers to the field itself.
+    copies = 0;
+    moves = 0;
+    assert(&ra.total() == &ra.r.total && &rac.total() == &rac.r.total);
+    assert(&rr.total() == &rec.total && &rrc.total() == &rec.total);
+    assert(&rp.total() == &rec.total && &rpc.total() == &rec.total && &rq.total() == &rec.total);
+    assert(&rs.total() == &rs.r->total && &rsc.total() == &rsc.r->total);
+    assert(&rt.total() == &rt.r->total && &ru.total() == &ru.r->total);
+    assert(&ro.total() == &rec.total && &std::move(rr).total() == &rec.total);
+    assert(3 == rp.slots()[1] && 3 == rs.slots()[1] && 3 == std::move(ru).slots()[1]);
+    rp.total().count = 4;
+    rs.total().count = 5;
+    assert(4 == rec.total.count && 4 == rq.total().count && 5 == rs.r->total.count);
+    assert(0 == copies && 0 == moves);
+
+    // Only a value member is moved from, once, when the wrapper is an rvalue.
+    tally stolen = std::move(ra).total();
+    assert(1 == stolen.count && 0 == copies && 1 == moves);
+    tally kept = std::move(rac).total();
+    assert(1 == kept.count && 1 == copies && 1 == moves);
+//INVALID rac.total().count = 0; // Assign a field through a const FORWARD_TO_MEMBER_FIELD wrapper.
+//INVALID rq.total().count = 0;  // Assign a field of a pointer to const through a FORWARD_TO_MEMBER_FIELD wrapper.
+//INVALID rt.total().count = 0;  // Assign a field of a shared pointer to const through a FORWARD_TO_MEMBER_FIELD wrapper.
+
+    // Create a FORWARD_TO_MEMBER_RANGE and FORWARD_TO_MEMBER_OPERATOR wrapper of every member kind.
+    std::vector<int> vec = {3, 1, 2};
+    gain k = {2};
+    series_value  va(vec, k);  const series_value  vac(vec, k);
+    series_ref    vr(vec, k);  const series_ref    vrc(vec, k);
+    series_ptr    vp(vec, k);  const series_ptr    vpc(vec, k);
+    series_ptrc   vq(vec, k);
+    series_shared vs(vec, k);  const series_shared vsc(vec, k);
+    series_unique vu(vec, k);
+
+    // Const wrappers give const iterators and elements and call the const operator() through any
+    // kind of member, non-const ones the others.
+    typedef std::vector<int>::iterator iterator;
+    typedef std::vector<int>::const_iterator const_iterator;
+    TEST_EXPOSED_TYPE(va.begin(),            iterator);
+    TEST_EXPOSED_TYPE(vac.begin(),           const_iterator);
+    TEST_EXPOSED_TYPE(va.cbegin(),           const_iterator);
+    TEST_EXPOSED_TYPE(std::move(va).end(),   iterator);
+    TEST_EXPOSED_TYPE(vr.end(),              iterator);
+    TEST_EXPOSED_TYPE(vrc.end(),             const_iterator);
+    TEST_EXPOSED_TYPE(vp.begin(),            iterator);
+    TEST_EXPOSED_TYPE(vpc.begin(),           const_iterator);
+    TEST_EXPOSED_TYPE(vq.begin(),            const_iterator);
+    TEST_EXPOSED_TYPE(vs.data(),             int*);
+    TEST_EXPOSED_TYPE(vsc.data(),            const int*);
+    TEST_EXPOSED_TYPE(vu[0],                 int&);
+    TEST_EXPOSED_TYPE(vpc[0],                const int&);
+    TEST_EXPOSED_TYPE(std::move(vp)[0],      int&);
+    TEST_EXPOSED_TYPE(vsc.size(),            std::vector<int>::size_type);
+    static_assert( noexcept(va.size()), "Forwarded operator should be noexcept.");
+    static_assert( noexcept(vpc(1)),    "Forwarded operator should be noexcept.");
+    static_assert(!noexcept(vp(1)),     "Forwarded operator should not be noexcept.");
+
+    // Range-based for loops and algorithms run over the wrappers as they do over the vector.
+    int total = 0;
+    for (int i : va)  { total += i; }
+    for (int i : vac) { total += i; }
+    for (int i : vrc) { total += i; }
+    for (int i : vpc) { total += i; }
+    for (int i : vq)  { total += i; }
+    for (int i : vsc) { total += i; }
+    for (int i : vu)  { total += i; }
+    assert(42 == total);
+    assert(6 == std::accumulate(vs.cbegin(), vs.cend(), 0) && 3 == vs.size() && 1 == vs.data()[1]);
+    std::sort(vp.begin(), vp.end());
+    assert(1 == vec[0] && 3 == vq[2] && 3 == vpc.end()[-1] && 3 == vr.size());
+    vr[0] = 4;
+    vu[0] = 5;
+    assert(4 == vec[0] && 4 == vq[0] && 5 == vu.v->front() && 3 == va[0]);
+
+    // The call operator keeps the cv class of the gain's overloads through every kind of member.
+    assert(4 == vpc(2) && 2 == k.factor && 6 == vp(2) && 3 == k.factor && 9 == vq(3));
+    assert(6 == vac(3) && 9 == va(3) && 8 == vsc(4) && 12 == vs(4) && 15 == vu(5));
+//INVALID vac[0] = 0;                        // Assign an element through a const FORWARD_TO_MEMBER_OPERATOR wrapper.
+//INVALID vpc[0] = 0;                        // Assign an element through a const FORWARD_TO_MEMBER_OPERATOR wrapper with a pointer.
+//INVALID vq[0] = 0;                         // Assign an element of a pointer to const through a FORWARD_TO_MEMBER_OPERATOR wrapper.
+//INVALID std::sort(vsc.begin(), vsc.end()); // Sort a const FORWARD_TO_MEMBER_RANGE wrapper with a shared pointer.
 }
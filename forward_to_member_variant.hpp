@@ -0,0 +1,219 @@
+/**
+ * This file provides the FORWARD_TO_MEMBER_VARIANT macro, which exposes a function calling a method
+ * on whichever alternative of a std::variant member is active:
+ *
+ *     class storage
+ *     {
+ *     private:
+ *         std::variant<memory_backend, disk_backend, remote_backend> backend;
+ *
+ *     public:
+ *         FORWARD_TO_MEMBER_VARIANT(backend, read, read);
+ *     };
+ *
+ * Every alternative must accept the call. The call dispatches through a table of functions, one
+ * per alternative, indexed by the index of the active alternative, so it costs a load and an
+ * indirect call whatever the number of alternatives. Requires C++17.
+ */
+
+#ifndef __INCLUDE_GUARD_FORWARD_MEMBER_VARIANT_HPP__
+#define __INCLUDE_GUARD_FORWARD_MEMBER_VARIANT_HPP__
+
+#if __cplusplus < 201703L
+#error "forward_to_member_variant.hpp requires C++17"
+#endif
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "forward_to_member.hpp"
+
+namespace detail
+{
+
+/**
+ * The type all the results of a call can be returned as: the result itself if every alternative
+ * returns the same type, their std::common_type otherwise, and nothing if they have none, which
+ * removes the exposed function from overload resolution.
+ */
+template<typename Void, typename... R>
+struct forward_member_variant_common { };
+
+template<typename... R>
+struct forward_member_variant_common<std::void_t<std::common_type_t<R...>>, R...>
+{
+    using type = std::common_type_t<R...>;
+};
+
+template<typename R, typename... Rs>
+struct forward_member_variant_unify
+    : public std::conditional_t<(std::is_same_v<R, Rs> && ...),
+                                std::enable_if<true, R>,
+                                forward_member_variant_common<void, R, Rs...>> { };
+
+/**
+ * Gets the result type of Call with the given constness on each alternative of Variant, unified by
+ * forward_member_variant_unify. There is none if some alternative doesn't accept the call.
+ */
+template<typename Call, bool Const, typename Variant, typename Indices, typename Void,
+         typename... TArgs>
+struct forward_member_variant_result { };
+
+template<typename Call, bool Const, typename Variant, std::size_t... I, typename... TArgs>
+struct forward_member_variant_result<
+    Call, Const, Variant, std::index_sequence<I...>,
+    std::void_t<decltype(Call::template call<Const>(
+        std::declval<std::variant_alternative_t<I, Variant>&>(), std::declval<TArgs>()...))...>,
+    TArgs...>
+    : public forward_member_variant_unify<decltype(Call::template call<Const>(
+          std::declval<std::variant_alternative_t<I, Variant>&>(), std::declval<TArgs>()...))...>
+{ };
+
+template<typename Call, bool Const, typename Variant, typename... TArgs>
+using forward_member_variant_result_t = typename forward_member_variant_result<
+    Call, Const, Variant, std::make_index_sequence<std::variant_size_v<Variant>>, void,
+    TArgs...>::type;
+
+/**
+ * True if the overload of the forwarded function selected on every alternative of Variant is const,
+ * as classified by Traits, the function traits generated for it. The alternatives can be pointers
+ * or pointer-like types, which are classified by the type they point to.
+ */
+template<template<typename, typename...> class Traits, typename Variant, typename Indices,
+         typename... TArgs>
+struct forward_member_variant_const;
+
+template<template<typename, typename...> class Traits, typename Variant, std::size_t... I,
+         typename... TArgs>
+struct forward_member_variant_const<Traits, Variant, std::index_sequence<I...>, TArgs...>
+    : public std::bool_constant<(Traits<typename forward_member_underlying_type<
+                                            std::variant_alternative_t<I, Variant>>::type&,
+                                        TArgs...>::has_const && ...)> { };
+
+template<template<typename, typename...> class Traits, typename Variant, typename... TArgs>
+constexpr bool forward_member_variant_const_v = forward_member_variant_const<
+    Traits, Variant, std::make_index_sequence<std::variant_size_v<Variant>>, TArgs...>::value;
+
+/**
+ * Gets the result type of the exposed function with the given constness, if every alternative of
+ * Variant accepts the call and the overloads they select are all const when Const is true, and not
+ * all const when it is false. The classification is only done once the call is known to be valid,
+ * since the function traits can't classify the overloads of a type lacking the function.
+ */
+template<bool Const, template<typename, typename...> class Traits, typename Call, typename Variant,
+         typename Void, typename... TArgs>
+struct forward_member_variant_enable { };
+
+template<bool Const, template<typename, typename...> class Traits, typename Call, typename Variant,
+         typename... TArgs>
+struct forward_member_variant_enable<
+    Const, Traits, Call, Variant,
+    std::void_t<forward_member_variant_result_t<Call, Const, Variant, TArgs...>>, TArgs...>
+    : public std::enable_if<Const == forward_member_variant_const_v<Traits, Variant, TArgs...>,
+                            forward_member_variant_result_t<Call, Const, Variant, TArgs...>> { };
+
+/**
+ * Table of the functions calling Call on each alternative of Variant, which is const qualified if
+ * the call is const.
+ */
+template<typename Call, bool Const, typename R, typename Variant, typename Indices,
+         typename... TArgs>
+struct forward_member_variant_table;
+
+template<typename Call, bool Const, typename R, typename Variant, std::size_t... I,
+         typename... TArgs>
+struct forward_member_variant_table<Call, Const, R, Variant, std::index_sequence<I...>, TArgs...>
+{
+    using function = R (*)(Variant&, TArgs&&...);
+
+    template<std::size_t Index>
+    static R call(Variant& variant, TArgs&&... args)
+    {
+        return Call::template call<Const>(*std::get_if<Index>(&variant),
+                                          std::forward<TArgs>(args)...);
+    }
+
+    static constexpr function functions[] = {&call<I>...};
+};
+
+/**
+ * Calls Call on the active alternative of variant through the table. A variant that is valueless
+ * after an exception throws std::bad_variant_access, as std::visit does.
+ */
+template<typename Call, bool Const, typename R, typename Variant, typename... TArgs>
+R forward_member_variant_dispatch(Variant& variant, TArgs&&... args)
+{
+    using table = forward_member_variant_table<
+        Call, Const, R, Variant,
+        std::make_index_sequence<std::variant_size_v<std::remove_cv_t<Variant>>>, TArgs...>;
+    const std::size_t index = variant.index();
+    if (index >= std::variant_size_v<std::remove_cv_t<Variant>>)
+    {
+        throw std::bad_variant_access();
+    }
+    return table::functions[index](variant, std::forward<TArgs>(args)...);
+}
+
+} /* End namespace detail. */
+
+/**
+ * Generates code which exposes a function in some class that invokes a method (potentially having
+ * several overloads) on the active alternative of a std::variant member. Every alternative must
+ * accept the call, and the results must all have the same type or a std::common_type, which is
+ * returned; otherwise the exposed function can't be called. Alternatives can be values, pointers or
+ * pointer-like types. The exposed function is const if the overload selected on every alternative
+ * is const, in which case it is called on a const alternative, and not const otherwise. Volatile
+ * overloads are not exposed.
+ *
+ * @param m The name of the std::variant member, held by value or reference.
+ * @param f The name of the function to invoke on the active alternative.
+ * @param n The name of the function to expose in the class.
+ */
+#define FORWARD_TO_MEMBER_VARIANT(m, f, n)                                                         \
+    using variant_type_##m##_##f##_##n = std::remove_cv_t<std::remove_reference_t<decltype(m)>>;   \
+                                                                                                   \
+    FORWARD_TO_MEMBER_DETAIL_TRAITS(m, f, n)                                                       \
+                                                                                                   \
+    /**                                                                                            \
+     * Calls the function on an alternative, made const if Const is true.                          \
+     */                                                                                            \
+    struct variant_call_##m##_##f##_##n                                                            \
+    {                                                                                              \
+        template <bool Const, typename T, typename... TArgs>                                       \
+        static auto call(T& alternative, TArgs&&... args)                                          \
+            -> decltype(detail::forward_member_target<Const, TArgs...>(alternative).f(             \
+                   std::forward<TArgs>(args)...))                                                  \
+        {                                                                                          \
+            return detail::forward_member_target<Const, TArgs...>(alternative).f(                  \
+                std::forward<TArgs>(args)...);                                                     \
+        }                                                                                          \
+    };                                                                                             \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args) const                                                                  \
+        -> typename detail::forward_member_variant_enable<                                         \
+               true, function_traits_##m##_##f##_##n, variant_call_##m##_##f##_##n,                \
+               variant_type_##m##_##f##_##n, void, TArgs...>::type                                 \
+    {                                                                                              \
+        return detail::forward_member_variant_dispatch<                                            \
+            variant_call_##m##_##f##_##n, true,                                                    \
+            detail::forward_member_variant_result_t<variant_call_##m##_##f##_##n, true,            \
+                                                    variant_type_##m##_##f##_##n, TArgs...>>(      \
+            static_cast<const variant_type_##m##_##f##_##n&>(m), std::forward<TArgs>(args)...);    \
+    }                                                                                              \
+                                                                                                   \
+    template <typename... TArgs>                                                                   \
+    auto n(TArgs&&... args)                                                                        \
+        -> typename detail::forward_member_variant_enable<                                         \
+               false, function_traits_##m##_##f##_##n, variant_call_##m##_##f##_##n,               \
+               variant_type_##m##_##f##_##n, void, TArgs...>::type                                 \
+    {                                                                                              \
+        return detail::forward_member_variant_dispatch<                                            \
+            variant_call_##m##_##f##_##n, false,                                                   \
+            detail::forward_member_variant_result_t<variant_call_##m##_##f##_##n, false,           \
+                                                    variant_type_##m##_##f##_##n, TArgs...>>(      \
+            static_cast<variant_type_##m##_##f##_##n&>(m), std::forward<TArgs>(args)...);          \
+    }
+
+#endif /* __INCLUDE_GUARD_FORWARD_MEMBER_VARIANT_HPP__ */
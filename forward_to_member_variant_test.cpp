@@ -0,0 +1,170 @@
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "forward_to_member_variant.hpp"
+
+/**
+ * Backends with the same methods, with const and non-const overloads of describe, of which the
+ * const one is exposed as with FORWARD_TO_MEMBER_AS.
+ */
+struct memory
+{
+    std::string name = "memory";
+    int size = 1;
+
+    int read(int offset) const { return offset + size; }
+    void write(int value) { size = value; }
+    const std::string& label() const { return name; }
+    std::string describe() const { return "const memory"; }
+    std::string describe() { return "memory"; }
+    int version() const { return 1; }
+    int mixed() const { return 1; }
+};
+
+struct disk
+{
+    std::string name = "disk";
+    int size = 10;
+
+    int read(int offset) const { return offset + size; }
+    void write(int value) { size = value; }
+    const std::string& label() const { return name; }
+    std::string describe() const { return "const disk"; }
+    std::string describe() { return "disk"; }
+    long version() const { return 2; }
+    std::string mixed() const { return "2"; }
+};
+
+/**
+ * Backend without some of the methods.
+ */
+struct partial
+{
+    int read(int offset) const { return offset; }
+};
+
+/**
+ * Backend throwing when moved, to make a variant valueless.
+ */
+struct fragile
+{
+    std::string name = "fragile";
+
+    fragile() = default;
+    fragile(const fragile&) = default;
+    fragile(fragile&&) { throw std::runtime_error("move"); }
+    fragile& operator=(fragile&&) = default;
+
+    int read(int offset) const { return offset; }
+    void write(int) { }
+    const std::string& label() const { return name; }
+    std::string describe() const { return "const fragile"; }
+    std::string describe() { return "fragile"; }
+    int version() const { return 3; }
+    int mixed() const { return 3; }
+};
+
+struct storage
+{
+    std::variant<memory, disk, fragile> backend;
+    FORWARD_TO_MEMBER_VARIANT(backend, read, read);
+    FORWARD_TO_MEMBER_VARIANT(backend, write, write);
+    FORWARD_TO_MEMBER_VARIANT(backend, label, label);
+    FORWARD_TO_MEMBER_VARIANT(backend, describe, describe);
+    FORWARD_TO_MEMBER_VARIANT(backend, version, version);
+    FORWARD_TO_MEMBER_VARIANT(backend, mixed, mixed);
+
+    std::variant<memory*, std::shared_ptr<disk>> remote;
+    FORWARD_TO_MEMBER_VARIANT(remote, read, remote_read);
+    FORWARD_TO_MEMBER_VARIANT(remote, write, remote_write);
+
+    std::variant<memory, partial> some;
+    FORWARD_TO_MEMBER_VARIANT(some, read, some_read);
+    FORWARD_TO_MEMBER_VARIANT(some, write, some_write);
+};
+
+/**
+ * True if n can be called on an object of type T with Args.
+ */
+#define CAN_CALL(n)                                                                                \
+    template <typename T, typename = void, typename... Args>                                       \
+    struct can_call_##n : std::false_type { };                                                     \
+                                                                                                   \
+    template <typename T, typename... Args>                                                        \
+    struct can_call_##n<T, std::void_t<decltype(std::declval<T>().n(std::declval<Args>()...))>,   \
+                        Args...> : std::true_type { };
+
+CAN_CALL(write)
+CAN_CALL(mixed)
+CAN_CALL(some_read)
+CAN_CALL(some_write)
+
+int main()
+{
+    storage s;
+    const storage& cs = s;
+
+    // The call goes to the active alternative.
+    assert(3 == cs.read(2));
+    s.backend = disk();
+    assert(12 == cs.read(2));
+    s.write(5);
+    assert(7 == cs.read(2) && 5 == std::get<disk>(s.backend).size);
+
+    // The exposed function is const only if the overload called on every alternative is.
+    static_assert(!can_call_write<const storage&, void, int>::value);
+    static_assert(can_call_write<storage&, void, int>::value);
+    assert("const disk" == s.describe() && "const disk" == cs.describe());
+
+    // Results of the same type are returned as they are, references included.
+    static_assert(std::is_same<const std::string&, decltype(cs.label())>::value);
+    assert(&std::get<disk>(s.backend).name == &cs.label());
+
+    // Results of different types are returned as their common type, or the call is rejected.
+    static_assert(std::is_same<long, decltype(cs.version())>::value);
+    assert(2 == cs.version());
+    static_assert(!can_call_mixed<const storage&, void>::value);
+
+    // Every alternative must accept the call.
+    static_assert(can_call_some_read<const storage&, void, int>::value);
+    static_assert(!can_call_some_write<storage&, void, int>::value);
+    s.some = partial();
+    assert(4 == s.some_read(4));
+
+    // Pointer and pointer-like alternatives are reached through the pointer.
+    memory m;
+    s.remote = &m;
+    s.remote_write(3);
+    assert(3 == m.size && 4 == s.remote_read(1));
+    s.remote = std::make_shared<disk>();
+    assert(11 == s.remote_read(1));
+
+    // A valueless variant throws like std::visit.
+    s.backend.emplace<fragile>();
+    assert(3 == cs.version());
+    bool thrown = false;
+    try
+    {
+        fragile replacement;
+        s.backend.emplace<fragile>(std::move(replacement));
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown && s.backend.valueless_by_exception());
+    thrown = false;
+    try
+    {
+        cs.read(1);
+    }
+    catch (const std::bad_variant_access&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+}
@@ -0,0 +1,40 @@
+/**
+ * This file replaces the global operator new and operator delete of a test with ones counting the
+ * allocations, so that the test can check that a call allocates nothing, or only what it must. It
+ * defines the replacements, so a program includes it from one translation unit only.
+ */
+
+#ifndef __INCLUDE_GUARD_TEST_ALLOCATION_COUNTER_HPP__
+#define __INCLUDE_GUARD_TEST_ALLOCATION_COUNTER_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Number of allocations made through the global operator new.
+ */
+static std::atomic<long> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif /* __INCLUDE_GUARD_TEST_ALLOCATION_COUNTER_HPP__ */